@@ -10,6 +10,7 @@
 #include "HCList_Internal.h"
 #include <string.h>
 #include <math.h>
+#include <assert.h>
 
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Object Type
@@ -18,6 +19,8 @@ const HCObjectTypeData HCListTypeDataInstance = {
     .base = {
         .ancestor = &HCObjectTypeDataInstance.base,
         .name = "HCList",
+        .identifier = HCTypeIdentifierList,
+        .kindMask = HCTypeKindMaskForIdentifier(HCTypeIdentifierObject) | HCTypeKindMaskForIdentifier(HCTypeIdentifierList),
     },
     .isEqual = (void*)HCListIsEqual,
     .hashValue = (void*)HCListHashValue,
@@ -41,7 +44,7 @@ HCListRef HCListCreate() {
 }
 
 HCListRef HCListCreateWithCapacity(HCInteger capacity) {
-    HCListRef self = calloc(sizeof(HCList), 1);
+    HCListRef self = HCObjectAllocate(sizeof(HCList));
     HCListInit(self, capacity);
     return self;
 }
@@ -54,13 +57,14 @@ void HCListInit(void* memory, HCInteger capacity) {
     HCListRef self = memory;
     self->capacity = capacity;
     self->count = 0;
+    self->storage = objects;
     self->objects = objects;
     self->base.type = HCListType;
 }
 
 void HCListDestroy(HCListRef self) {
     HCListClear(self);
-    free(self->objects);
+    free(self->storage);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -161,15 +165,126 @@ HCRef HCListObjectAtIndex(HCListRef self, HCInteger index) {
     return !HCListContainsIndex(self, index) ? NULL : self->objects[index];
 }
 
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Storage
+//----------------------------------------------------------------------------------------------------------------------------------
+//  Objects occupy a contiguous run of the storage that may be preceded by empty slots as well as followed by them, similar to the deque storage of CFArray.
+//  Objects are added and removed by shifting whichever side of the run is shorter, so adding and removing objects at either end takes constant amortized time.
+//  When the side being shifted into has no empty slots, the run is moved within the storage, or to larger storage, leaving empty slots on the side the objects were added.
+
+/// Moves the objects of a list into storage with a capacity, leaving a gap of slots at an index.
+/// @param self A reference to the list.
+/// @param capacity The capacity of the storage. If it differs from the current capacity, new storage is allocated.
+/// @param frontCount The number of empty slots to leave before the first object.
+/// @param index The index of the object the gap should precede.
+/// @param gapCount The number of slots to leave between the objects before @c index and the objects after it.
+static void HCListMoveObjects(HCListRef self, HCInteger capacity, HCInteger frontCount, HCInteger index, HCInteger gapCount) {
+    HCRef* storage = capacity == self->capacity ? self->storage : malloc(capacity * sizeof(HCRef));
+    // TODO: Check for malloc failure
+    HCRef* objects = storage + frontCount;
+    if (storage != self->storage) {
+        memcpy(objects, self->objects, index * sizeof(HCRef));
+        memcpy(objects + index + gapCount, self->objects + index, (self->count - index) * sizeof(HCRef));
+        free(self->storage);
+    }
+    else if (objects > self->objects) {
+        // NOTE: Objects after the index are moved first when moving towards the end, so they are not overwritten
+        memmove(objects + index + gapCount, self->objects + index, (self->count - index) * sizeof(HCRef));
+        memmove(objects, self->objects, index * sizeof(HCRef));
+    }
+    else {
+        memmove(objects, self->objects, index * sizeof(HCRef));
+        memmove(objects + index + gapCount, self->objects + index, (self->count - index) * sizeof(HCRef));
+    }
+    self->storage = storage;
+    self->objects = objects;
+    self->capacity = capacity;
+}
+
+/// Opens a gap of empty slots in a list at an index, increasing the list count by the number of slots.
+/// @param self A reference to the list.
+/// @param index The index of the first slot of the gap.
+/// @param gapCount The number of slots to open.
+static void HCListOpenGap(HCListRef self, HCInteger index, HCInteger gapCount) {
+    // Shift the shorter side of the objects into the empty slots on that side
+    HCInteger frontCount = self->objects - self->storage;
+    HCInteger backCount = self->capacity - frontCount - self->count;
+    HCBoolean isNearFront = index < self->count - index;
+    if (isNearFront && frontCount >= gapCount) {
+        memmove(self->objects - gapCount, self->objects, index * sizeof(HCRef));
+        self->objects -= gapCount;
+    }
+    else if (!isNearFront && backCount >= gapCount) {
+        memmove(self->objects + index + gapCount, self->objects + index, (self->count - index) * sizeof(HCRef));
+    }
+    else {
+        // Grow the storage until at least half as many empty slots as objects remain, then distribute the empty slots towards the gap
+        HCInteger count = self->count + gapCount;
+        HCInteger capacity = self->capacity > 0 ? self->capacity : 1;
+        while (capacity - count < count / 2) {
+            capacity *= 2;
+        }
+        HCInteger emptyCount = capacity - count;
+        HCInteger emptyFrontCount = self->count == 0 ? 0 : emptyCount * (self->count - index) / self->count;
+        HCListMoveObjects(self, capacity, emptyFrontCount, index, gapCount);
+    }
+    self->count += gapCount;
+}
+
+/// Closes a gap of slots in a list at an index, decreasing the list count by the number of slots.
+/// @param self A reference to the list.
+/// @param index The index of the first slot of the gap.
+/// @param gapCount The number of slots to close.
+static void HCListCloseGap(HCListRef self, HCInteger index, HCInteger gapCount) {
+    // Shift the shorter side of the objects over the gap
+    HCInteger afterCount = self->count - index - gapCount;
+    if (index < afterCount) {
+        memmove(self->objects + gapCount, self->objects, index * sizeof(HCRef));
+        self->objects += gapCount;
+    }
+    else {
+        memmove(self->objects + index, self->objects + index + gapCount, afterCount * sizeof(HCRef));
+    }
+    self->count -= gapCount;
+    if (self->count == 0) {
+        self->objects = self->storage;
+    }
+}
+
+void HCListEnsureCapacity(HCListRef self, HCInteger capacity) {
+    // Double the capacity until the requested number of objects fit after the first object
+    HCInteger frontCount = self->objects - self->storage;
+    if (frontCount + capacity <= self->capacity) {
+        return;
+    }
+    HCInteger increasedCapacity = self->capacity > 0 ? self->capacity : 1;
+    while (increasedCapacity < capacity) {
+        increasedCapacity *= 2;
+    }
+    HCListMoveObjects(self, increasedCapacity, 0, self->count, 0);
+}
+
+/// Halves the capacity of a list while its objects fill no more than a quarter of it, after objects have been removed.
+static void HCListReduceCapacity(HCListRef self) {
+    // NOTE: Shrinking only at a quarter full keeps a list whose count oscillates around a power of two from reallocating on every operation
+    HCInteger decreasedCapacity = self->capacity;
+    while (self->count > 0 && decreasedCapacity / 4 >= self->count) {
+        decreasedCapacity /= 2;
+    }
+    if (decreasedCapacity == self->capacity) {
+        return;
+    }
+    HCListMoveObjects(self, decreasedCapacity, (decreasedCapacity - self->count) / 2, self->count, 0);
+}
+
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Operations
 //----------------------------------------------------------------------------------------------------------------------------------
 void HCListClear(HCListRef self) {
     // Release all object references and set count to zero
-    for (HCInteger index = 0; index < self->count; index++) {
-        HCRelease(self->objects[index]);
-    }
+    HCReleaseArray(self->objects, self->count);
     self->count = 0;
+    self->objects = self->storage;
 }
 
 void HCListAddObject(HCListRef self, HCRef object) {
@@ -180,54 +295,59 @@ void HCListRemoveObject(HCListRef self) {
     HCListRemoveObjectAtIndex(self, self->count - 1);
 }
 
+void HCListAddFirstObject(HCListRef self, HCRef object) {
+    HCListAddObjectAtIndex(self, 0, object);
+}
+
+void HCListRemoveFirstObject(HCListRef self) {
+    HCListRemoveObjectAtIndex(self, 0);
+}
+
 void HCListAddObjectAtIndex(HCListRef self, HCInteger index, HCRef object) {
-    // Check that the add index is acceptable
-    if (!HCListContainsIndex(self, index) && index != self->count) {
-        // TODO: Error, or just rely on list not increasing in count to indicate?
-        return;
-    }
-    
-    // Check that there is sufficient space for the object
-    if (self->capacity == self->count) {
-        HCInteger increasedCapacity = self->capacity * 2;
-        self->objects = realloc(self->objects, increasedCapacity * sizeof(HCRef));
-        // TODO: Check for realloc failure
-        self->capacity = increasedCapacity;
-    }
-    
-    // Shift objects to make a slot available for the object
-    self->count++;
-    for (HCInteger moveIndex = self->count - 1; moveIndex > index; moveIndex--) {
-        self->objects[moveIndex] = self->objects[moveIndex - 1];
-    }
-    
-    // Add the object
-    self->objects[index] = HCRetain(object);
+    HCListAddObjects(self, index, &object, 1);
 }
 
 void HCListRemoveObjectAtIndex(HCListRef self, HCInteger index) {
-    // Check that the remove index is acceptable
-    if (!HCListContainsIndex(self, index)) {
-        // TODO: Error, or just rely on list not decreasing in count to indicate?
+    // TODO: Return object?
+    HCListRemoveObjectsInRange(self, index, 1);
+}
+
+void HCListAddObjects(HCListRef self, HCInteger index, HCRef* objects, HCInteger count) {
+    HCListReplaceObjectsInRange(self, index, 0, objects, count);
+}
+
+void HCListRemoveObjectsInRange(HCListRef self, HCInteger index, HCInteger count) {
+    HCListReplaceObjectsInRange(self, index, count, NULL, 0);
+}
+
+void HCListReplaceObjectsInRange(HCListRef self, HCInteger index, HCInteger count, HCRef* objects, HCInteger objectCount) {
+    // Check that the range is acceptable
+    if (index < 0 || count < 0 || objectCount < 0 || index > self->count || count > self->count - index) {
+        // TODO: Error, or just rely on list not changing in count to indicate?
         return;
     }
     
-    // Remove the object
-    // TODO: Return object?
-    HCRelease(self->objects[index]);
+    // Retain the added objects before releasing the replaced objects, in case they are the same objects
+    HCRetainArray(objects, objectCount);
+    HCReleaseArray(self->objects + index, count);
     
-    // Shift objects to close the slot the object occupied
-    for (HCInteger moveIndex = index; moveIndex < self->count - 1; moveIndex++) {
-        self->objects[moveIndex] = self->objects[moveIndex + 1];
+    // Open or close slots so the added objects exactly replace the range
+    // NOTE: The list grows at most once and the objects on only one side of the range are shifted
+    if (objectCount > count) {
+        HCListOpenGap(self, index + count, objectCount - count);
     }
-    self->count--;
-
-    // Check if removing the object allows for a reduction in capacity
-    if (self->capacity == self->count * 2) {
-        HCInteger decreasedCapacity = self->capacity / 2;
-        self->objects = realloc(self->objects, decreasedCapacity * sizeof(HCRef));
-        // TODO: Check for realloc failure
-        self->capacity = decreasedCapacity;
+    else if (objectCount < count) {
+        HCListCloseGap(self, index + objectCount, count - objectCount);
+    }
+    
+    // Add the objects
+    if (objectCount > 0) {
+        memcpy(self->objects + index, objects, objectCount * sizeof(HCRef));
+    }
+    
+    // Check if removing the objects allows for a reduction in capacity
+    if (objectCount < count) {
+        HCListReduceCapacity(self);
     }
 }
 
@@ -247,12 +367,31 @@ void HCListRemoveObjectEqualToObject(HCListRef self, HCInteger searchIndex, HCBo
 }
 
 void HCListRemoveAllObjectsEqualToObject(HCListRef self, HCRef object) {
-    // Remove all objects equal to the requested object, back to front
-    // TODO: Deque better for speed?
-    for (HCInteger index = self->count - 1; index >= 0; index--) {
-        if (HCIsEqual(object, HCListObjectAtIndex(self, index))) {
-            HCListRemoveObjectAtIndex(self, index);
+    // Compact the objects not equal to the requested object towards the front in one pass, releasing removed objects in batches
+    HCRef removed[HCListRemoveBatchCountStatic];
+    HCInteger removedCount = 0;
+    HCInteger keptCount = 0;
+    for (HCInteger index = 0; index < self->count; index++) {
+        HCRef element = self->objects[index];
+        if (!HCIsEqual(object, element)) {
+            self->objects[keptCount++] = element;
+            continue;
+        }
+        removed[removedCount++] = element;
+        if (removedCount == HCListRemoveBatchCountStatic) {
+            HCReleaseArray(removed, removedCount);
+            removedCount = 0;
+        }
+    }
+    HCReleaseArray(removed, removedCount);
+    
+    // Update the count to the objects kept
+    if (keptCount != self->count) {
+        self->count = keptCount;
+        if (self->count == 0) {
+            self->objects = self->storage;
         }
+        HCListReduceCapacity(self);
     }
 }
 
@@ -270,6 +409,17 @@ HCRef HCListRemoveObjectRetained(HCListRef self) {
     return object;
 }
 
+void HCListAddFirstObjectReleased(HCListRef self, HCRef object) {
+    HCListAddFirstObject(self, object);
+    HCRelease(object);
+}
+
+HCRef HCListRemoveFirstObjectRetained(HCListRef self) {
+    HCRef object = HCRetain(HCListFirstObject(self));
+    HCListRemoveFirstObject(self);
+    return object;
+}
+
 void HCListAddObjectReleasedAtIndex(HCListRef self, HCInteger index, HCRef object) {
     HCListAddObjectAtIndex(self, index, object);
     HCRelease(object);
@@ -296,6 +446,238 @@ HCRef HCListRemoveObjectRetainedEqualToObject(HCListRef self, HCInteger searchIn
     return HCListRemoveObjectRetainedAtIndex(self, index);
 }
 
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Sorting
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Exchanges two object references.
+static void HCListSortSwap(HCRef* object, HCRef* otherObject) {
+    HCRef swapped = *object;
+    *object = *otherObject;
+    *otherObject = swapped;
+}
+
+/// Sorts a short array of objects by insertion, keeping the relative order of objects that order equally.
+static void HCListSortInsertion(HCRef* objects, HCInteger count, HCListCompareFunction compare, void* context) {
+    for (HCInteger index = 1; index < count; index++) {
+        HCRef object = objects[index];
+        HCInteger insertIndex = index;
+        while (insertIndex > 0 && compare(context, objects[insertIndex - 1], object) > 0) {
+            objects[insertIndex] = objects[insertIndex - 1];
+            insertIndex--;
+        }
+        objects[insertIndex] = object;
+    }
+}
+
+/// Sorts an array of objects using heapsort, bounding the time taken by introsort on adversarial input.
+static void HCListSortHeap(HCRef* objects, HCInteger count, HCListCompareFunction compare, void* context) {
+    for (HCInteger heapCount = count, start = count / 2 - 1; heapCount > 1; ) {
+        // Build the heap from its last parent, then repeatedly move the largest object to the end of the array
+        HCInteger parent;
+        if (start >= 0) {
+            parent = start--;
+        }
+        else {
+            heapCount--;
+            HCListSortSwap(objects, objects + heapCount);
+            parent = 0;
+        }
+        
+        // Sift the parent object down to its place in the heap
+        for (HCInteger child = parent * 2 + 1; child < heapCount; child = parent * 2 + 1) {
+            if (child + 1 < heapCount && compare(context, objects[child], objects[child + 1]) < 0) {
+                child++;
+            }
+            if (compare(context, objects[parent], objects[child]) >= 0) {
+                break;
+            }
+            HCListSortSwap(objects + parent, objects + child);
+            parent = child;
+        }
+    }
+}
+
+/// Sorts an array of objects using introsort.
+/// @param objects The objects to sort.
+/// @param count The number of objects to sort.
+/// @param depthLimit The number of partitioning levels remaining before switching to heapsort.
+/// @param compare A function called to order pairs of objects.
+/// @param context A value passed unmodified to @c compare.
+static void HCListSortIntrosort(HCRef* objects, HCInteger count, HCInteger depthLimit, HCListCompareFunction compare, void* context) {
+    while (count > HCListSortInsertionCountStatic) {
+        if (depthLimit-- == 0) {
+            HCListSortHeap(objects, count, compare, context);
+            return;
+        }
+        
+        // Order the first, middle, and last objects, then move their median to the front as the pivot
+        // NOTE: The ordered first and last objects bound both partitioning scans, so they need no range checks
+        HCRef* first = objects;
+        HCRef* middle = objects + count / 2;
+        HCRef* last = objects + count - 1;
+        if (compare(context, *middle, *first) < 0) {
+            HCListSortSwap(middle, first);
+        }
+        if (compare(context, *last, *middle) < 0) {
+            HCListSortSwap(last, middle);
+            if (compare(context, *middle, *first) < 0) {
+                HCListSortSwap(middle, first);
+            }
+        }
+        HCListSortSwap(first, middle);
+        HCRef pivot = *first;
+        
+        // Partition the objects around the pivot, stopping on objects equal to the pivot so runs of equal objects split evenly
+        HCInteger lowIndex = 0;
+        HCInteger highIndex = count;
+        while (true) {
+            do {
+                lowIndex++;
+            } while (compare(context, objects[lowIndex], pivot) < 0);
+            do {
+                highIndex--;
+            } while (compare(context, pivot, objects[highIndex]) < 0);
+            if (lowIndex >= highIndex) {
+                break;
+            }
+            HCListSortSwap(objects + lowIndex, objects + highIndex);
+        }
+        HCListSortSwap(objects, objects + highIndex);
+        
+        // Sort the smaller partition recursively and the larger one iteratively, bounding the recursion depth
+        HCInteger lowCount = highIndex;
+        HCInteger highCount = count - highIndex - 1;
+        if (lowCount < highCount) {
+            HCListSortIntrosort(objects, lowCount, depthLimit, compare, context);
+            objects += highIndex + 1;
+            count = highCount;
+        }
+        else {
+            HCListSortIntrosort(objects + highIndex + 1, highCount, depthLimit, compare, context);
+            count = lowCount;
+        }
+    }
+    HCListSortInsertion(objects, count, compare, context);
+}
+
+/// Merges two adjacent sorted arrays of objects into a destination, taking objects from the first array when they order equally.
+static void HCListSortMerge(HCRef* objects, HCInteger count, HCRef* otherObjects, HCInteger otherCount, HCRef* destination, HCListCompareFunction compare, void* context) {
+    // Copy without comparing each object if the arrays are already in order
+    if (count == 0 || otherCount == 0 || compare(context, objects[count - 1], otherObjects[0]) <= 0) {
+        memcpy(destination, objects, count * sizeof(HCRef));
+        memcpy(destination + count, otherObjects, otherCount * sizeof(HCRef));
+        return;
+    }
+    HCInteger index = 0;
+    HCInteger otherIndex = 0;
+    while (index < count && otherIndex < otherCount) {
+        if (compare(context, objects[index], otherObjects[otherIndex]) <= 0) {
+            *destination++ = objects[index++];
+        }
+        else {
+            *destination++ = otherObjects[otherIndex++];
+        }
+    }
+    memcpy(destination, objects + index, (count - index) * sizeof(HCRef));
+    memcpy(destination + count - index, otherObjects + otherIndex, (otherCount - otherIndex) * sizeof(HCRef));
+}
+
+/// Sorts an array of objects using bottom-up merge sort, keeping the relative order of objects that order equally.
+/// @param objects The objects to sort.
+/// @param count The number of objects to sort.
+/// @param buffer Temporary storage for at least @c count objects.
+/// @param compare A function called to order pairs of objects.
+/// @param context A value passed unmodified to @c compare.
+static void HCListSortMergeSort(HCRef* objects, HCInteger count, HCRef* buffer, HCListCompareFunction compare, void* context) {
+    // Sort short runs by insertion
+    for (HCInteger start = 0; start < count; start += HCListSortInsertionCountStatic) {
+        HCInteger runCount = count - start < HCListSortInsertionCountStatic ? count - start : HCListSortInsertionCountStatic;
+        HCListSortInsertion(objects + start, runCount, compare, context);
+    }
+    
+    // Merge runs of doubling width, alternating between the objects and the buffer
+    HCRef* source = objects;
+    HCRef* destination = buffer;
+    for (HCInteger width = HCListSortInsertionCountStatic; width < count; width *= 2) {
+        for (HCInteger start = 0; start < count; start += width * 2) {
+            HCInteger runCount = count - start < width ? count - start : width;
+            HCInteger otherRunCount = count - start - runCount < width ? count - start - runCount : width;
+            HCListSortMerge(source + start, runCount, source + start + runCount, otherRunCount, destination + start, compare, context);
+        }
+        HCRef* merged = destination;
+        destination = source;
+        source = merged;
+    }
+    if (source != objects) {
+        memcpy(objects, source, count * sizeof(HCRef));
+    }
+}
+
+/// Determines the index of the first element of a sorted list that does not order before an object, or the first that orders after it.
+/// @param self A reference to the list.
+/// @param object The object to order against elements of the list.
+/// @param isAfterEqual If @c true, finds the first element that orders after @c object. If @c false, finds the first element that does not order before @c object.
+/// @param compare A function called to order @c object against elements of the list.
+/// @param context A value passed unmodified to @c compare.
+/// @returns The index found, which is @c HCListCount() if all elements order before @c object.
+static HCInteger HCListSortedIndex(HCListRef self, HCRef object, HCBoolean isAfterEqual, HCListCompareFunction compare, void* context) {
+    HCInteger lowIndex = 0;
+    HCInteger highIndex = self->count;
+    while (lowIndex < highIndex) {
+        HCInteger middleIndex = lowIndex + (highIndex - lowIndex) / 2;
+        HCInteger order = compare(context, self->objects[middleIndex], object);
+        if (order < 0 || (isAfterEqual && order == 0)) {
+            lowIndex = middleIndex + 1;
+        }
+        else {
+            highIndex = middleIndex;
+        }
+    }
+    return lowIndex;
+}
+
+void HCListSort(HCListRef self, HCListCompareFunction compare, void* context) {
+    // Check if the list is already sorted, which is common when sorting after adding a few objects
+    HCInteger index = 1;
+    while (index < self->count && compare(context, self->objects[index - 1], self->objects[index]) <= 0) {
+        index++;
+    }
+    if (index >= self->count) {
+        return;
+    }
+    
+    // Limit partitioning to twice the logarithm of the count before falling back to heapsort
+    HCInteger depthLimit = 0;
+    for (HCInteger remaining = self->count; remaining > 1; remaining /= 2) {
+        depthLimit += 2;
+    }
+    HCListSortIntrosort(self->objects, self->count, depthLimit, compare, context);
+}
+
+void HCListSortStable(HCListRef self, HCListCompareFunction compare, void* context) {
+    if (self->count <= HCListSortInsertionCountStatic) {
+        HCListSortInsertion(self->objects, self->count, compare, context);
+        return;
+    }
+    HCRef* buffer = malloc(self->count * sizeof(HCRef));
+    // TODO: Failable
+    HCListSortMergeSort(self->objects, self->count, buffer, compare, context);
+    free(buffer);
+}
+
+HCInteger HCListBinarySearch(HCListRef self, HCRef object, HCListCompareFunction compare, void* context) {
+    HCInteger index = HCListSortedIndex(self, object, false, compare, context);
+    if (index < self->count && compare(context, self->objects[index], object) == 0) {
+        return index;
+    }
+    return HCListNotFound;
+}
+
+void HCListAddObjectSorted(HCListRef self, HCRef object, HCListCompareFunction compare, void* context) {
+    HCListAddObjectAtIndex(self, HCListSortedIndex(self, object, true, compare, context), object);
+}
+
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Iteration
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -374,19 +756,33 @@ HCListRef HCListFilterRetained(HCListRef self, HCListFilterFunction isIncluded,
     if (isIncluded == NULL) {
         return filtered;
     }
+    
+    // Collect included objects, then retain them together
     for (HCListIterator i = HCListIterationBegin(self); !HCListIterationHasEnded(&i); HCListIterationNext(&i)) {
         if (isIncluded(context, i.list, i.index, i.object)) {
-            HCListAddObject(filtered, i.object);
+            HCListEnsureCapacity(filtered, filtered->count + 1);
+            filtered->objects[filtered->count++] = i.object;
         }
     }
+    HCRetainArray(filtered->objects, filtered->count);
     return filtered;
 }
 
 HCListRef HCListMapRetained(HCListRef self, HCListMapFunction transform, void* context) {
     HCListRef mapped = HCListCreateWithCapacity(HCListCount(self));
+    
+    // Copy and retain all objects together when there is no transform
+    if (transform == NULL) {
+        memcpy(mapped->objects, self->objects, self->count * sizeof(HCRef));
+        mapped->count = self->count;
+        HCRetainArray(mapped->objects, mapped->count);
+        return mapped;
+    }
+    
+    // Take ownership of the retained transformed objects
     for (HCListIterator i = HCListIterationBegin(self); !HCListIterationHasEnded(&i); HCListIterationNext(&i)) {
-        HCRef mappedValue = transform == NULL ? HCRetain(i.object) : transform(context, i.list, i.index, i.object);
-        HCListAddObjectReleased(mapped, mappedValue);
+        HCListEnsureCapacity(mapped, mapped->count + 1);
+        mapped->objects[mapped->count++] = transform(context, i.list, i.index, i.object);
     }
     return mapped;
 }
@@ -403,3 +799,239 @@ HCRef HCListReduceRetained(HCListRef self, HCRef initialValue, HCListReduceFunct
     }
     return aggregateValue;
 }
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Parallel Iteration Convenience Operations
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Determines the number of chunks a list should be divided into for a parallel operation.
+/// @param self A reference to the list.
+/// @returns The number of chunks, which is enough to balance work across threads but never more than the number of elements.
+static HCInteger HCListParallelChunkCount(HCListRef self) {
+    HCInteger chunkCount = HCThreadPoolThreadCount() * HCListParallelChunksPerThreadStatic;
+    return self->count < chunkCount ? self->count : chunkCount;
+}
+
+/// Determines the range of elements in a chunk of a list.
+/// @param operation The parallel operation dividing the list into chunks.
+/// @param chunkIndex The index of the chunk.
+/// @param start The index of the first element of the chunk.
+/// @param end The index following the last element of the chunk.
+static void HCListParallelChunkRange(HCListParallelOperation* operation, HCInteger chunkIndex, HCInteger* start, HCInteger* end) {
+    *start = operation->list->count * chunkIndex / operation->chunkCount;
+    *end = operation->list->count * (chunkIndex + 1) / operation->chunkCount;
+}
+
+/// Calls the for-each function on each element of a chunk.
+static void HCListForEachParallelChunk(void* context, HCInteger chunkIndex) {
+    HCListParallelOperation* operation = context;
+    HCListForEachFunction forEachFunction = (HCListForEachFunction)operation->function;
+    HCInteger start, end;
+    HCListParallelChunkRange(operation, chunkIndex, &start, &end);
+    for (HCInteger index = start; index < end; index++) {
+        forEachFunction(operation->context, operation->list, index, operation->list->objects[index]);
+    }
+}
+
+/// Records whether each element of a chunk is included by the filter function, and the number of included elements.
+static void HCListFilterParallelChunk(void* context, HCInteger chunkIndex) {
+    HCListParallelOperation* operation = context;
+    HCListFilterFunction isIncluded = (HCListFilterFunction)operation->function;
+    HCInteger start, end;
+    HCListParallelChunkRange(operation, chunkIndex, &start, &end);
+    HCInteger includedCount = 0;
+    for (HCInteger index = start; index < end; index++) {
+        operation->isIncluded[index] = isIncluded(operation->context, operation->list, index, operation->list->objects[index]);
+        includedCount += operation->isIncluded[index] ? 1 : 0;
+    }
+    operation->chunkOffsets[chunkIndex] = includedCount;
+}
+
+/// Copies the included elements of a chunk into the filtered list, starting at the chunk's offset.
+static void HCListFilterParallelCopyChunk(void* context, HCInteger chunkIndex) {
+    HCListParallelOperation* operation = context;
+    HCInteger start, end;
+    HCListParallelChunkRange(operation, chunkIndex, &start, &end);
+    HCRef* results = operation->results + operation->chunkOffsets[chunkIndex];
+    HCInteger resultCount = 0;
+    for (HCInteger index = start; index < end; index++) {
+        if (operation->isIncluded[index]) {
+            results[resultCount++] = operation->list->objects[index];
+        }
+    }
+}
+
+/// Maps each element of a chunk into the corresponding slot of the mapped list.
+static void HCListMapParallelChunk(void* context, HCInteger chunkIndex) {
+    HCListParallelOperation* operation = context;
+    HCListMapFunction transform = (HCListMapFunction)operation->function;
+    HCInteger start, end;
+    HCListParallelChunkRange(operation, chunkIndex, &start, &end);
+    if (transform == NULL) {
+        memcpy(operation->results + start, operation->list->objects + start, (end - start) * sizeof(HCRef));
+        return;
+    }
+    for (HCInteger index = start; index < end; index++) {
+        operation->results[index] = transform(operation->context, operation->list, index, operation->list->objects[index]);
+    }
+}
+
+/// Reduces the elements of a chunk from the initial value into the chunk's partial result.
+static void HCListReduceParallelChunk(void* context, HCInteger chunkIndex) {
+    HCListParallelOperation* operation = context;
+    HCListReduceFunction nextPartialResult = (HCListReduceFunction)operation->function;
+    HCInteger start, end;
+    HCListParallelChunkRange(operation, chunkIndex, &start, &end);
+    HCRef aggregateValue = HCRetain(operation->initialValue);
+    for (HCInteger index = start; index < end; index++) {
+        HCRef intermediateValue = nextPartialResult(operation->context, aggregateValue, operation->list, index, operation->list->objects[index]);
+        HCRelease(aggregateValue);
+        aggregateValue = intermediateValue;
+    }
+    operation->partialResults[chunkIndex] = aggregateValue;
+}
+
+/// Combines a pair of adjacent partial results into one partial result of the next level of the reduction tree.
+static void HCListReduceParallelCombine(void* context, HCInteger pairIndex) {
+    HCListParallelOperation* operation = context;
+    HCRef partialResult = operation->partialResults[pairIndex * 2];
+    HCRef otherPartialResult = operation->partialResults[pairIndex * 2 + 1];
+    operation->results[pairIndex] = operation->combine(operation->context, partialResult, otherPartialResult);
+    HCRelease(partialResult);
+    HCRelease(otherPartialResult);
+}
+
+/// Sorts the elements of a chunk in place, using the chunk's range of the merge buffer as temporary storage.
+static void HCListSortParallelChunk(void* context, HCInteger chunkIndex) {
+    HCListParallelOperation* operation = context;
+    HCInteger start, end;
+    HCListParallelChunkRange(operation, chunkIndex, &start, &end);
+    HCListSortMergeSort(operation->list->objects + start, end - start, operation->results + start, (HCListCompareFunction)operation->function, operation->context);
+}
+
+/// Merges a pair of adjacent sorted runs of chunks into one sorted run of the next merge level.
+static void HCListSortParallelMerge(void* context, HCInteger pairIndex) {
+    HCListParallelOperation* operation = context;
+    HCInteger firstChunkIndex = pairIndex * operation->mergeChunkCount * 2;
+    HCInteger middleChunkIndex = firstChunkIndex + operation->mergeChunkCount;
+    HCInteger endChunkIndex = middleChunkIndex + operation->mergeChunkCount;
+    middleChunkIndex = middleChunkIndex < operation->chunkCount ? middleChunkIndex : operation->chunkCount;
+    endChunkIndex = endChunkIndex < operation->chunkCount ? endChunkIndex : operation->chunkCount;
+    HCInteger start, middle, end, unused;
+    HCListParallelChunkRange(operation, firstChunkIndex, &start, &unused);
+    HCListParallelChunkRange(operation, middleChunkIndex, &middle, &unused);
+    HCListParallelChunkRange(operation, endChunkIndex, &end, &unused);
+    HCRef* source = operation->mergeSource;
+    HCListSortMerge(source + start, middle - start, source + middle, end - middle, operation->mergeDestination + start, (HCListCompareFunction)operation->function, operation->context);
+}
+
+void HCListForEachParallel(HCListRef self, HCListForEachFunction forEachFunction, void* context) {
+    if (forEachFunction == NULL) {
+        return;
+    }
+    HCListParallelOperation operation = { .list = self, .chunkCount = HCListParallelChunkCount(self), .function = forEachFunction, .context = context };
+    HCThreadPoolExecute(operation.chunkCount, HCListForEachParallelChunk, &operation);
+}
+
+HCListRef HCListFilterRetainedParallel(HCListRef self, HCListFilterFunction isIncluded, void* context) {
+    if (isIncluded == NULL) {
+        return HCListCreate();
+    }
+    
+    // Determine which elements are included, and the offset of each chunk's included elements in the filtered list
+    HCListParallelOperation operation = { .list = self, .chunkCount = HCListParallelChunkCount(self), .function = isIncluded, .context = context };
+    operation.isIncluded = malloc(self->count * sizeof(HCBoolean));
+    operation.chunkOffsets = malloc(operation.chunkCount * sizeof(HCInteger));
+    // TODO: Failable
+    HCThreadPoolExecute(operation.chunkCount, HCListFilterParallelChunk, &operation);
+    HCInteger filteredCount = 0;
+    for (HCInteger chunkIndex = 0; chunkIndex < operation.chunkCount; chunkIndex++) {
+        HCInteger includedCount = operation.chunkOffsets[chunkIndex];
+        operation.chunkOffsets[chunkIndex] = filteredCount;
+        filteredCount += includedCount;
+    }
+    
+    // Copy included elements into the filtered list in their original order, then retain them together
+    // NOTE: Elements are retained on the calling thread, so that elements confined to it are never retained by a worker thread
+    HCListRef filtered = HCListCreateWithCapacity(filteredCount > 0 ? filteredCount : 1);
+    operation.results = filtered->objects;
+    HCThreadPoolExecute(operation.chunkCount, HCListFilterParallelCopyChunk, &operation);
+    HCRetainArray(filtered->objects, filteredCount);
+    filtered->count = filteredCount;
+    free(operation.isIncluded);
+    free(operation.chunkOffsets);
+    return filtered;
+}
+
+HCListRef HCListMapRetainedParallel(HCListRef self, HCListMapFunction transform, void* context) {
+    // Map each element into its slot of the mapped list, taking ownership of the retained transformed objects
+    HCListRef mapped = HCListCreateWithCapacity(self->count > 0 ? self->count : 1);
+    HCListParallelOperation operation = { .list = self, .chunkCount = HCListParallelChunkCount(self), .function = transform, .context = context, .results = mapped->objects };
+    HCThreadPoolExecute(operation.chunkCount, HCListMapParallelChunk, &operation);
+    
+    // Retain copied elements on the calling thread, so that elements confined to it are never retained by a worker thread
+    if (transform == NULL) {
+        HCRetainArray(mapped->objects, self->count);
+    }
+    mapped->count = self->count;
+    return mapped;
+}
+
+HCRef HCListReduceRetainedParallel(HCListRef self, HCRef initialValue, HCListReduceFunction nextPartialResult, HCListCombineFunction combine, void* context) {
+    if (nextPartialResult == NULL || combine == NULL || self->count == 0) {
+        return HCListReduceRetained(self, initialValue, nextPartialResult, context);
+    }
+    
+    // Reduce each chunk to a partial result
+    // NOTE: The initial value is retained and released by worker threads, so it must not be confined to a thread
+    assert(!HCObjectIsThreadConfined(initialValue) && "Thread-confined initial value reduced on multiple threads");
+    HCListParallelOperation operation = { .list = self, .chunkCount = HCListParallelChunkCount(self), .function = nextPartialResult, .combine = combine, .context = context, .initialValue = initialValue };
+    operation.partialResults = malloc(operation.chunkCount * sizeof(HCRef));
+    operation.results = malloc(operation.chunkCount * sizeof(HCRef));
+    // TODO: Failable
+    HCThreadPoolExecute(operation.chunkCount, HCListReduceParallelChunk, &operation);
+    
+    // Combine adjacent partial results level by level until one remains, carrying an unpaired last result to the next level
+    HCInteger partialResultCount = operation.chunkCount;
+    while (partialResultCount > 1) {
+        HCInteger pairCount = partialResultCount / 2;
+        HCThreadPoolExecute(pairCount, HCListReduceParallelCombine, &operation);
+        if (partialResultCount % 2 == 1) {
+            operation.results[pairCount] = operation.partialResults[partialResultCount - 1];
+        }
+        partialResultCount = (partialResultCount + 1) / 2;
+        HCRef* results = operation.results;
+        operation.results = operation.partialResults;
+        operation.partialResults = results;
+    }
+    HCRef result = operation.partialResults[0];
+    free(operation.partialResults);
+    free(operation.results);
+    return result;
+}
+
+void HCListSortParallel(HCListRef self, HCListCompareFunction compare, void* context) {
+    HCListParallelOperation operation = { .list = self, .chunkCount = HCListParallelChunkCount(self), .function = compare, .context = context };
+    if (operation.chunkCount < 2 || self->count < operation.chunkCount * HCListSortInsertionCountStatic) {
+        HCListSortStable(self, compare, context);
+        return;
+    }
+    
+    // Sort each chunk, then merge runs of chunks of doubling width, alternating between the list and the buffer
+    operation.results = malloc(self->count * sizeof(HCRef));
+    // TODO: Failable
+    HCThreadPoolExecute(operation.chunkCount, HCListSortParallelChunk, &operation);
+    operation.mergeSource = self->objects;
+    operation.mergeDestination = operation.results;
+    for (operation.mergeChunkCount = 1; operation.mergeChunkCount < operation.chunkCount; operation.mergeChunkCount *= 2) {
+        HCInteger pairCount = (operation.chunkCount + operation.mergeChunkCount * 2 - 1) / (operation.mergeChunkCount * 2);
+        HCThreadPoolExecute(pairCount, HCListSortParallelMerge, &operation);
+        HCRef* merged = operation.mergeDestination;
+        operation.mergeDestination = operation.mergeSource;
+        operation.mergeSource = merged;
+    }
+    if (operation.mergeSource != self->objects) {
+        memcpy(self->objects, operation.mergeSource, self->count * sizeof(HCRef));
+    }
+    free(operation.results);
+}
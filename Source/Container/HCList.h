@@ -77,6 +77,20 @@ typedef HCRef (*HCListMapFunction)(void* context, HCListRef list, HCInteger inde
 /// @param object The object at the current iteration index.
 typedef HCRef (*HCListReduceFunction)(void* context, HCRef aggregate, HCListRef list, HCInteger index, HCRef object);
 
+/// Function used to combine two partial results of a parallel reduce iteration over a list.
+/// @param context The unmodified context value provided to @c HCListReduceRetainedParallel().
+/// @param partialResult The partial result aggregating elements preceding those of @c otherPartialResult.
+/// @param otherPartialResult The partial result aggregating elements following those of @c partialResult.
+/// @returns The combined result, which must be retained.
+typedef HCRef (*HCListCombineFunction)(void* context, HCRef partialResult, HCRef otherPartialResult);
+
+/// Function used to order two values of a list when sorting or searching a sorted list.
+/// @param context The unmodified context value provided to the sorting or searching function.
+/// @param object The object to order.
+/// @param otherObject The object to order @c object against.
+/// @returns A negative value if @c object orders before @c otherObject, a positive value if it orders after @c otherObject, or zero if they order equally.
+typedef HCInteger (*HCListCompareFunction)(void* context, HCRef object, HCRef otherObject);
+
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Construction
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -207,6 +221,30 @@ void HCListAddObject(HCListRef self, HCRef object);
 /// @param self A reference to the list to modify.
 void HCListRemoveObject(HCListRef self);
 
+/// Prepends an element to the start of a list.
+///
+/// When the object is added to the list, the list retains the object as part of the operation and will release it when it is removed from the list.
+/// The caller is still required to release the object when it finishes with the object.
+/// For a call that releases the object after adding it to the list in one operation, see @c HCListAddFirstObjectReleased().
+///
+/// Lists keep empty slots before their first element as well as after their last, so adding and removing elements at either end takes constant amortized time.
+/// This allows a list to be used as a queue or double-ended queue.
+///
+/// @param self A reference to the list to modify.
+/// @param object The object to prepend as an element to the list.
+void HCListAddFirstObject(HCListRef self, HCRef object);
+
+/// Removes an element from the start of a list.
+///
+/// When the object is removed from the list, the list releases the object as part of the operation.
+/// Since the object is released when it is removed from the list, the caller cannot receive the removed object for other use.
+/// For a call that retains the object before removing it from the list and returns it, see @c HCListRemoveFirstObjectRetained().
+///
+/// If the list is empty, this function does nothing.
+///
+/// @param self A reference to the list to modify.
+void HCListRemoveFirstObject(HCListRef self);
+
 /// Inserts an element into a list at an index.
 ///
 /// When the object is added to the list, the list retains the object as part of the operation and will release it when it is removed from the list.
@@ -228,6 +266,39 @@ void HCListAddObjectAtIndex(HCListRef self, HCInteger index, HCRef object);
 /// @param index The index of the object to remove. If the index does not exist in the list, the list is left unmodified.
 void HCListRemoveObjectAtIndex(HCListRef self, HCInteger index);
 
+/// Inserts elements from a C array into a list at an index.
+///
+/// The list retains each object as part of the operation, as with @c HCListAddObjectAtIndex().
+/// The objects following @c index are shifted once for the whole array, and the list grows at most once.
+///
+/// @param self A reference to the list to modify.
+/// @param index The index in the list the first object should occupy. Should be in the range @code [0, HCListCount()] @endcode, otherwise the list is left unmodified.
+/// @param objects The objects to add as elements into the list. Must not point into the storage of @c self.
+/// @param count The number of objects in @c objects.
+void HCListAddObjects(HCListRef self, HCInteger index, HCRef* objects, HCInteger count);
+
+/// Removes a contiguous range of elements from a list.
+///
+/// The list releases each removed object as part of the operation, as with @c HCListRemoveObjectAtIndex().
+/// The objects following the range are shifted once for the whole range.
+///
+/// @param self A reference to the list to modify.
+/// @param index The index of the first object to remove.
+/// @param count The number of objects to remove. If the range @code [index, index + count) @endcode is not contained in the list, the list is left unmodified.
+void HCListRemoveObjectsInRange(HCListRef self, HCInteger index, HCInteger count);
+
+/// Replaces a contiguous range of elements in a list with the objects in a C array.
+///
+/// The list releases each replaced object and retains each added object as part of the operation.
+/// The range and the array may differ in length, in which case the objects following the range are shifted once and the list grows at most once.
+///
+/// @param self A reference to the list to modify.
+/// @param index The index of the first object to replace.
+/// @param count The number of objects to replace. If the range @code [index, index + count) @endcode is not contained in the list, the list is left unmodified.
+/// @param objects The objects to add as elements into the list in place of the range. Must not point into the storage of @c self.
+/// @param objectCount The number of objects in @c objects.
+void HCListReplaceObjectsInRange(HCListRef self, HCInteger index, HCInteger count, HCRef* objects, HCInteger objectCount);
+
 /// Searches for and removes an object from the start of a list.
 /// @param self A reference to the list to modify.
 /// @param object The object to search for. Uses @c HCIsEqual() to determine when the object has been found. If no element is equal to @c object, the list is left unmodified.
@@ -274,6 +345,26 @@ void HCListAddObjectReleased(HCListRef self, HCRef object);
 /// @returns The last object in the list. If the list is empty, the list is left unmodified and the function returns @c NULL.
 HCRef HCListRemoveObjectRetained(HCListRef self);
 
+/// Prepends an element to the start of a list and then releases it.
+///
+/// When the object is added to the list, the list releases it after adding it to its element collection.
+/// The caller is no longer required to release the object and the list has retained it.
+/// For a call that keeps the object retained by both the caller and the list, see @c HCListAddFirstObject().
+///
+/// @param self A reference to the list to modify.
+/// @param object The object to prepend as an element to the list.
+void HCListAddFirstObjectReleased(HCListRef self, HCRef object);
+
+/// Removes an element from the start of a list after retaining it.
+///
+/// When the object is removed from the list, the list retains it prior to removing it.
+/// This allows the caller to receive the removed object for other use, but the caller must later release it.
+/// For a call that does not require the caller to release the removed object, see @c HCListRemoveFirstObject().
+///
+/// @param self A reference to the list to modify.
+/// @returns The first object in the list. If the list is empty, the list is left unmodified and the function returns @c NULL.
+HCRef HCListRemoveFirstObjectRetained(HCListRef self);
+
 /// Inserts an element into a list at an index.
 ///
 /// When the object is added to the list, the list releases it after adding it to its element collection.
@@ -312,6 +403,47 @@ HCRef HCListRemoveLastObjectRetainedEqualToObject(HCListRef self, HCRef object);
 /// @param object The object to search for. Uses @c HCIsEqual() to determine when the object has been found. If no element is equal to @c object, the list is left unmodified and the function returns @c NULL.
 HCRef HCListRemoveObjectRetainedEqualToObject(HCListRef self, HCInteger searchIndex, HCBoolean reverseSearch, HCRef object);
 
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Sorting
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Sorts the elements of a list.
+///
+/// Uses introsort, so sorting takes O(n log n) time in the worst case and already sorted lists are detected in O(n) time.
+/// Elements that order equally may not keep their relative order. For a sort that keeps it, see @c HCListSortStable().
+///
+/// @param self A reference to the list to sort.
+/// @param compare A function called to order pairs of elements.
+/// @param context A value passed unmodified to @c compare.
+void HCListSort(HCListRef self, HCListCompareFunction compare, void* context);
+
+/// Sorts the elements of a list, keeping the relative order of elements that order equally.
+///
+/// Uses merge sort, so sorting takes O(n log n) time and temporary storage for the elements of the list.
+///
+/// @param self A reference to the list to sort.
+/// @param compare A function called to order pairs of elements.
+/// @param context A value passed unmodified to @c compare.
+void HCListSortStable(HCListRef self, HCListCompareFunction compare, void* context);
+
+/// Searches a sorted list for an object in O(log n) time.
+/// @param self A reference to the list, which must be sorted according to @c compare.
+/// @param object The object to search for.
+/// @param compare A function called to order @c object against elements of the list.
+/// @param context A value passed unmodified to @c compare.
+/// @returns The first index of an element that orders equally to @c object, or @c HCListNotFound if there is none.
+HCInteger HCListBinarySearch(HCListRef self, HCRef object, HCListCompareFunction compare, void* context);
+
+/// Inserts an element into a sorted list such that the list remains sorted.
+///
+/// The object is inserted after any elements that order equally to it, and the list retains it as with @c HCListAddObjectAtIndex().
+///
+/// @param self A reference to the list to modify, which must be sorted according to @c compare.
+/// @param object The object to add as an element into the list.
+/// @param compare A function called to order @c object against elements of the list.
+/// @param context A value passed unmodified to @c compare.
+void HCListAddObjectSorted(HCListRef self, HCRef object, HCListCompareFunction compare, void* context);
+
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Iteration
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -433,4 +565,54 @@ HCListRef HCListMapRetained(HCListRef self, HCListMapFunction transform, void* c
 /// @returns A reference to the object from the last call to nextPartialResult. Must be released by the caller.
 HCRef HCListReduceRetained(HCListRef self, HCRef initialValue, HCListReduceFunction nextPartialResult, void* context);
 
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Parallel Iteration Convenience Operations
+//----------------------------------------------------------------------------------------------------------------------------------
+// NOTE: Parallel operations divide the list into chunks of consecutive elements that are processed concurrently by a pool of worker
+//       threads and the calling thread. Functions passed to them are called concurrently and in no particular order, and the list must
+//       not be modified until the operation returns. Elements are only retained on the calling thread, but elements confined to a thread
+//       must not be retained or released by the passed functions, and the initial value of a reduction must not be confined to a thread.
+
+/// Iterates over the elements of a list calling a function on each, using multiple threads.
+/// @param self A reference to the list.
+/// @param forEachFunction The function to be called on each element. Called concurrently from multiple threads.
+/// @param context A value passed unmodified to @c forEachFunction.
+void HCListForEachParallel(HCListRef self, HCListForEachFunction forEachFunction, void* context);
+
+/// Filters the elements in a list into a new list, using multiple threads.
+/// @param self A reference to the list.
+/// @param isIncluded A function called on each element in the list to determine if it should be included in the returned list. Called concurrently from multiple threads.
+/// @param context A value passed unmodified to @c isIncluded.
+/// @returns A reference to a list created to hold the filtered elements in their original order. If no elements are selected to be included, an empty list will be returned. Must be released by the caller.
+HCListRef HCListFilterRetainedParallel(HCListRef self, HCListFilterFunction isIncluded, void* context);
+
+/// Maps the elements in a list to new values in a new list, using multiple threads.
+/// @param self A reference to the list.
+/// @param transform A function called on each element to create a representative in the new list. Called concurrently from multiple threads.
+/// @param context A value passed unmodified to @c transform.
+/// @returns A reference to a list created to hold the mapped elements in the order of the elements they represent. Must be released by the caller.
+HCListRef HCListMapRetainedParallel(HCListRef self, HCListMapFunction transform, void* context);
+
+/// Reduces the elements in a list to a single value, using multiple threads.
+///
+/// Each chunk of the list is reduced from @c initialValue using @c nextPartialResult, and the partial results of adjacent chunks are then combined pairwise using @c combine until one result remains.
+/// For the result to match @c HCListReduceRetained(), @c combine must be associative and @c initialValue must be an identity value of @c combine.
+///
+/// @param self A reference to the list.
+/// @param initialValue The initial value passed to @c nextPartialResult for each chunk of the list.
+/// @param nextPartialResult A function called on each element to aggregate the element's content into the partial result value of its chunk. Called concurrently from multiple threads.
+/// @param combine A function called to combine the partial results of adjacent chunks. Called concurrently from multiple threads.
+/// @param context A value passed unmodified to @c nextPartialResult and @c combine.
+/// @returns A reference to the combined result of all chunks. Must be released by the caller.
+HCRef HCListReduceRetainedParallel(HCListRef self, HCRef initialValue, HCListReduceFunction nextPartialResult, HCListCombineFunction combine, void* context);
+
+/// Sorts the elements of a list, keeping the relative order of elements that order equally, using multiple threads.
+///
+/// Each chunk of the list is sorted using @c HCListSortStable(), and adjacent sorted chunks are then merged pairwise until the list is sorted.
+///
+/// @param self A reference to the list to sort.
+/// @param compare A function called to order pairs of elements. Called concurrently from multiple threads.
+/// @param context A value passed unmodified to @c compare.
+void HCListSortParallel(HCListRef self, HCListCompareFunction compare, void* context);
+
 #endif /* HCList_h */
@@ -12,6 +12,30 @@
 
 #include "../Core/HCObject_Internal.h"
 #include "HCList.h"
+#include "../Thread/HCThreadPool_Internal.h"
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Definitions
+//----------------------------------------------------------------------------------------------------------------------------------
+#define HCListParallelChunksPerThreadStatic (4)
+#define HCListRemoveBatchCountStatic (64)
+#define HCListSortInsertionCountStatic (16)
+
+typedef struct HCListParallelOperation {
+    HCListRef list;
+    HCInteger chunkCount;
+    void* function;
+    HCListCombineFunction combine;
+    void* context;
+    HCRef initialValue;
+    HCBoolean* isIncluded;
+    HCInteger* chunkOffsets;
+    HCRef* results;
+    HCRef* partialResults;
+    HCInteger mergeChunkCount;
+    HCRef* mergeSource;
+    HCRef* mergeDestination;
+} HCListParallelOperation;
 
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Object Type
@@ -20,6 +44,7 @@ typedef struct HCList {
     HCObject base;
     HCInteger count;
     HCInteger capacity;
+    HCRef* storage;
     HCRef* objects;
 } HCList;
 
@@ -29,4 +54,9 @@ typedef struct HCList {
 void HCListInit(void* memory, HCInteger capacity);
 void HCListDestroy(HCListRef self);
 
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Storage
+//----------------------------------------------------------------------------------------------------------------------------------
+void HCListEnsureCapacity(HCListRef self, HCInteger capacity);
+
 #endif /* HCList_Internal_h */
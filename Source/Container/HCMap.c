@@ -10,7 +10,7 @@
 #include "HCMap_Internal.h"
 #include <string.h>
 #include <math.h>
-#include "../Data/HCString.h"
+#include "../Data/HCString_Internal.h"
 
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Object Type
@@ -19,6 +19,8 @@ const HCObjectTypeData HCMapTypeDataInstance = {
     .base = {
         .ancestor = &HCObjectTypeDataInstance.base,
         .name = "HCMap",
+        .identifier = HCTypeIdentifierMap,
+        .kindMask = HCTypeKindMaskForIdentifier(HCTypeIdentifierObject) | HCTypeKindMaskForIdentifier(HCTypeIdentifierMap),
     },
     .isEqual = (void*)HCMapIsEqual,
     .hashValue = (void*)HCMapHashValue,
@@ -38,31 +40,231 @@ const HCMapIterator HCMapIteratorInvalid = { .map = NULL, .index = HCMapNotFound
 // MARK: - Construction
 //----------------------------------------------------------------------------------------------------------------------------------
 HCMapRef HCMapCreate() {
-    return HCMapCreateWithCapacity(8);
+    return HCMapCreateWithCapacity(HCMapMinimumCapacityStatic);
 }
 
 HCMapRef HCMapCreateWithCapacity(HCInteger capacity) {
-    HCMapRef self = calloc(sizeof(HCMap), 1);
-    HCMapInit(self, capacity);
+    return HCMapCreateWithOptions(capacity, HCMapOptionNone);
+}
+
+HCMapRef HCMapCreateWithOptions(HCInteger capacity, HCMapOption options) {
+    HCMapRef self = HCObjectAllocate(sizeof(HCMap));
+    HCMapInit(self, capacity, options);
     return self;
 }
 
-void HCMapInit(void* memory, HCInteger capacity) {
-    HCSetRef keys = HCSetCreateWithCapacity(capacity);
-    HCSetRef pairs = HCSetCreateWithCapacity(capacity);
+void HCMapInit(void* memory, HCInteger capacity, HCMapOption options) {
+    // Allocate enough slots and entries to contain the requested capacity of keys without exceeding the load factor
+    // NOTE: Setting all bytes of a slot to 0xFF sets it to HCMapNotFound, marking it empty
+    HCInteger slotCount = HCMapSlotCountForCapacity(capacity);
+    HCInteger entryCapacity = HCMapEntryCapacityForSlotCount(slotCount);
+    HCInteger* slots = malloc(slotCount * sizeof(HCInteger));
+    memset(slots, 0xFF, slotCount * sizeof(HCInteger));
+    HCMapEntry* entries = malloc(entryCapacity * sizeof(HCMapEntry));
+    HCMapValueSlot* valueSlots = options & HCMapOptionIndexValues ? calloc(slotCount, sizeof(HCMapValueSlot)) : NULL;
+    HCMapValueEntry* valueEntries = options & HCMapOptionIndexValues ? malloc(entryCapacity * sizeof(HCMapValueEntry)) : NULL;
     // TODO: Check that the allocation proceeded successfully, determine how to pass the error otherwise
     
     HCObjectInit(memory);
     HCMapRef self = memory;
-    self->keys = keys;
-    self->pairs = pairs;
+    self->options = options;
+    self->count = 0;
+    self->capacity = slotCount;
+    self->slots = slots;
+    self->entryCount = 0;
+    self->entryCapacity = entryCapacity;
+    self->entries = entries;
+    self->liveCounts = NULL;
+    self->valueSlots = valueSlots;
+    self->valueEntries = valueEntries;
     self->base.type = HCMapType;
 }
 
 void HCMapDestroy(HCMapRef self) {
     HCMapClear(self);
-    HCRelease(self->keys);
-    HCRelease(self->pairs);
+    free(self->slots);
+    free(self->entries);
+    free(self->valueSlots);
+    free(self->valueEntries);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Storage
+//----------------------------------------------------------------------------------------------------------------------------------
+HCInteger HCMapSlotCountForCapacity(HCInteger capacity) {
+    // Find the smallest power-of-two slot count that can hold the capacity without exceeding the load factor
+    HCInteger slotCount = HCMapMinimumCapacityStatic;
+    while (HCMapEntryCapacityForSlotCount(slotCount) < capacity) {
+        slotCount *= 2;
+    }
+    return slotCount;
+}
+
+HCInteger HCMapEntryCapacityForSlotCount(HCInteger slotCount) {
+    return slotCount * HCMapLoadFactorNumeratorStatic / HCMapLoadFactorDenominatorStatic;
+}
+
+HCInteger HCMapSlotIndexForHash(HCMapRef self, HCInteger hash) {
+    // Mix the hash so that hashes differing only in their high bits, such as those of integers with common low bits, spread over the slots
+    // NOTE: The slot count is always a power of two, so masking is equivalent to an unsigned modulo
+    uint64_t mixed = (uint64_t)hash * 0x9E3779B97F4A7C15ull;
+    return (HCInteger)((mixed ^ (mixed >> 32)) & (uint64_t)(self->capacity - 1));
+}
+
+void HCMapResize(HCMapRef self, HCInteger slotCount) {
+    // Remove holes left by removed keys so the entries fit in their new capacity
+    HCMapCompact(self);
+    
+    // Resize the entries array and replace the slot array
+    HCInteger entryCapacity = HCMapEntryCapacityForSlotCount(slotCount);
+    self->entries = realloc(self->entries, entryCapacity * sizeof(HCMapEntry));
+    if (self->valueEntries != NULL) {
+        self->valueEntries = realloc(self->valueEntries, entryCapacity * sizeof(HCMapValueEntry));
+    }
+    self->entryCapacity = entryCapacity;
+    free(self->slots);
+    self->slots = malloc(slotCount * sizeof(HCInteger));
+    HCInteger previousSlotCount = self->capacity;
+    self->capacity = slotCount;
+    // TODO: Check that the allocation proceeded successfully, determine how to pass the error otherwise
+    
+    // Index each entry in the new slot array using its cached key hash, which avoids both hashing and equality checks
+    memset(self->slots, 0xFF, slotCount * sizeof(HCInteger));
+    HCInteger mask = slotCount - 1;
+    for (HCInteger entryIndex = 0; entryIndex < self->entryCount; entryIndex++) {
+        HCInteger slotIndex = HCMapSlotIndexForHash(self, self->entries[entryIndex].hash);
+        while (self->slots[slotIndex] != HCMapNotFound) {
+            slotIndex = (slotIndex + 1) & mask;
+        }
+        self->slots[slotIndex] = entryIndex;
+    }
+    
+    // Index the objects again in a value slot array of the same slot count
+    if (self->valueSlots != NULL) {
+        HCMapValueSlot* previousValueSlots = self->valueSlots;
+        self->valueSlots = calloc(slotCount, sizeof(HCMapValueSlot));
+        HCMapValueIndexRebuild(self, previousValueSlots, previousSlotCount);
+        free(previousValueSlots);
+    }
+}
+
+void HCMapCompact(HCMapRef self) {
+    // Discard the live counts, which are only needed while holes remain
+    free(self->liveCounts);
+    self->liveCounts = NULL;
+    
+    // Nothing to do when no keys have been removed since the last compaction
+    if (self->entryCount == self->count) {
+        return;
+    }
+    
+    // Move entries down over holes left by removed keys, preserving their order
+    HCInteger* entryIndexMap = malloc(self->entryCount * sizeof(HCInteger));
+    HCInteger compactedCount = 0;
+    for (HCInteger entryIndex = 0; entryIndex < self->entryCount; entryIndex++) {
+        if (self->entries[entryIndex].key == NULL) {
+            entryIndexMap[entryIndex] = HCMapNotFound;
+            continue;
+        }
+        entryIndexMap[entryIndex] = compactedCount;
+        self->entries[compactedCount] = self->entries[entryIndex];
+        if (self->valueEntries != NULL) {
+            self->valueEntries[compactedCount] = self->valueEntries[entryIndex];
+        }
+        compactedCount++;
+    }
+    self->entryCount = compactedCount;
+    
+    // Point the slots at the moved entries
+    for (HCInteger slotIndex = 0; slotIndex < self->capacity; slotIndex++) {
+        HCInteger entryIndex = self->slots[slotIndex];
+        if (entryIndex != HCMapNotFound) {
+            self->slots[slotIndex] = entryIndexMap[entryIndex];
+        }
+    }
+    free(entryIndexMap);
+}
+
+void HCMapLiveCountsBuild(HCMapRef self) {
+    // Count the keys in each entry, then add the count of each node of the tree to its parent, whose range of entries contains its own
+    // NOTE: The node at 1-based position p counts the keys in the (p & -p) entries ending at entry p - 1, and is stored at index p - 1
+    HCInteger* liveCounts = malloc(self->entryCapacity * sizeof(HCInteger));
+    // TODO: Check that the allocation proceeded successfully, determine how to pass the error otherwise
+    for (HCInteger entryIndex = 0; entryIndex < self->entryCapacity; entryIndex++) {
+        liveCounts[entryIndex] = entryIndex < self->entryCount && self->entries[entryIndex].key != NULL ? 1 : 0;
+    }
+    for (HCInteger position = 1; position <= self->entryCapacity; position++) {
+        HCInteger parentPosition = position + (position & -position);
+        if (parentPosition <= self->entryCapacity) {
+            liveCounts[parentPosition - 1] += liveCounts[position - 1];
+        }
+    }
+    self->liveCounts = liveCounts;
+}
+
+void HCMapLiveCountsAdd(HCMapRef self, HCInteger entryIndex, HCInteger delta) {
+    // Update every node whose range of entries contains the entry
+    for (HCInteger position = entryIndex + 1; position <= self->entryCapacity; position += position & -position) {
+        self->liveCounts[position - 1] += delta;
+    }
+}
+
+HCInteger HCMapLiveCountsFindEntryIndex(HCMapRef self, HCInteger index) {
+    // Descend from the largest node, advancing past each node whose keys all precede the key at the iteration index
+    HCInteger step = 1;
+    while (step * 2 <= self->entryCapacity) {
+        step *= 2;
+    }
+    HCInteger position = 0;
+    HCInteger remaining = index + 1;
+    for (; step > 0; step /= 2) {
+        if (position + step <= self->entryCapacity && self->liveCounts[position + step - 1] < remaining) {
+            position += step;
+            remaining -= self->liveCounts[position - 1];
+        }
+    }
+    
+    // The position reached is the 1-based position of the entry preceding the key, which is the entry index of the key
+    return position;
+}
+
+void HCMapRemoveSlotAtIndex(HCMapRef self, HCInteger slotIndex) {
+    // Release the key and object, leaving a hole in the entries array and in the probe sequence
+    HCInteger entryIndex = self->slots[slotIndex];
+    HCMapEntry* entry = &self->entries[entryIndex];
+    HCMapValueIndexRemoveEntryAtIndex(self, entryIndex);
+    HCRelease(entry->key);
+    HCRelease(entry->object);
+    entry->key = NULL;
+    entry->object = NULL;
+    entry->hash = 0;
+    self->count--;
+    
+    // Drop trailing holes from the entries array so that removing the most recently added key leaves no hole
+    while (self->entryCount > 0 && self->entries[self->entryCount - 1].key == NULL) {
+        self->entryCount--;
+    }
+    
+    // Remove the key from the live counts, building them instead when this is the first hole not at the end of the entries
+    if (self->liveCounts != NULL) {
+        HCMapLiveCountsAdd(self, entryIndex, -1);
+    }
+    else if (self->entryCount != self->count) {
+        HCMapLiveCountsBuild(self);
+    }
+    
+    // Close the hole in the probe sequence by shifting back following slots that are allowed to occupy it
+    // NOTE: A slot may fill the hole when the hole lies between its ideal slot and its current slot, which keeps the table free of tombstones
+    HCInteger mask = self->capacity - 1;
+    HCInteger holeIndex = slotIndex;
+    for (HCInteger index = (holeIndex + 1) & mask; self->slots[index] != HCMapNotFound; index = (index + 1) & mask) {
+        HCInteger idealIndex = HCMapSlotIndexForHash(self, self->entries[self->slots[index]].hash);
+        if (((index - idealIndex) & mask) >= ((index - holeIndex) & mask)) {
+            self->slots[holeIndex] = self->slots[index];
+            holeIndex = index;
+        }
+    }
+    self->slots[holeIndex] = HCMapNotFound;
 }
 
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -83,7 +285,15 @@ HCBoolean HCMapIsEqual(HCMapRef self, HCMapRef other) {
 }
 
 HCInteger HCMapHashValue(HCMapRef self) {
-    return HCHashValue(self->pairs);
+    // NOTE: Key hashes are summed so that equal maps hash equally regardless of their insertion order
+    HCInteger hash = 5381;
+    for (HCInteger entryIndex = 0; entryIndex < self->entryCount; entryIndex++) {
+        HCMapEntry* entry = &self->entries[entryIndex];
+        if (entry->key != NULL) {
+            hash += entry->hash;
+        }
+    }
+    return hash;
 }
 
 void HCMapPrint(HCMapRef self, FILE* stream) {
@@ -107,14 +317,80 @@ HCBoolean HCMapIsEmpty(HCMapRef self) {
 }
 
 HCInteger HCMapCount(HCMapRef self) {
-    return HCSetCount(self->keys);
+    return self->count;
+}
+
+HCMapOption HCMapOptions(HCMapRef self) {
+    return self->options;
 }
 
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Searching
 //----------------------------------------------------------------------------------------------------------------------------------
+void HCMapFindSlotContainingKey(HCMapRef self, HCRef key, HCInteger* keySlotIndex, HCBoolean* found, HCMapEntry** resultEntry, HCInteger* keyHashValue) {
+    // Report failure on requests to find the null key
+    if (key == NULL) {
+        if (keySlotIndex != NULL) {
+            *keySlotIndex = HCMapNotFound;
+        }
+        if (found != NULL) {
+            *found = false;
+        }
+        if (resultEntry != NULL) {
+            *resultEntry = NULL;
+        }
+        if (keyHashValue != NULL) {
+            *keyHashValue = 0;
+        }
+        return;
+    }
+    
+    // Probe linearly from the ideal slot index for the key, comparing cached hashes before checking equality
+    // NOTE: The load factor guarantees an empty slot exists, which terminates the probe when the key is not in the map
+    HCInteger keyHash = HCHashValue(key);
+    HCInteger mask = self->capacity - 1;
+    HCInteger slotIndex = HCMapSlotIndexForHash(self, keyHash);
+    HCMapEntry* entry = NULL;
+    for (; self->slots[slotIndex] != HCMapNotFound; slotIndex = (slotIndex + 1) & mask) {
+        HCMapEntry* candidate = &self->entries[self->slots[slotIndex]];
+        if (candidate->hash == keyHash && HCIsEqual(candidate->key, key)) {
+            entry = candidate;
+            break;
+        }
+    }
+    
+    // Report the slot containing the key, or the empty slot the key should occupy
+    if (keySlotIndex != NULL) {
+        *keySlotIndex = slotIndex;
+    }
+    if (found != NULL) {
+        *found = entry != NULL;
+    }
+    if (resultEntry != NULL) {
+        *resultEntry = entry;
+    }
+    if (keyHashValue != NULL) {
+        *keyHashValue = keyHash;
+    }
+}
+
+HCMapEntry* HCMapEntryAtIterationIndex(HCMapRef self, HCInteger index) {
+    // Iteration indices correspond directly to entry indices when there are no holes left by removed keys
+    if (index < 0 || index >= self->count) {
+        return NULL;
+    }
+    if (self->entryCount == self->count) {
+        return &self->entries[index];
+    }
+    
+    // Otherwise find the entry holding the key at the iteration index using the live counts, which are kept while holes remain
+    return &self->entries[HCMapLiveCountsFindEntryIndex(self, index)];
+}
+
 HCBoolean HCMapContainsKey(HCMapRef self, HCRef key) {
-    return HCSetContainsObject(self->keys, key);
+    HCBoolean found = false;
+    HCMapFindSlotContainingKey(self, key, NULL, &found, NULL, NULL);
+    return found;
 }
 
 HCRef HCMapFirstKey(HCMapRef self) {
@@ -126,17 +402,54 @@ HCRef HCMapLastKey(HCMapRef self) {
 }
 
 HCRef HCMapKeyAtIterationIndex(HCMapRef self, HCInteger index) {
-    return HCSetObjectAtIterationIndex(self->keys, index);
+    HCMapEntry* entry = HCMapEntryAtIterationIndex(self, index);
+    return entry == NULL ? NULL : entry->key;
 }
 
 HCBoolean HCMapContainsObject(HCMapRef self, HCRef object) {
+    return HCMapKeyForObject(self, object) != NULL;
+}
+
+HCRef HCMapKeyForObject(HCMapRef self, HCRef object) {
+    // Look up the object in the value index when one is maintained
+    if (self->valueSlots != NULL) {
+        HCMapValueSlot* valueSlot = HCMapValueIndexFindSlotContainingObject(self, object);
+        return valueSlot == NULL ? NULL : HCMapValueSlotKeys(valueSlot)[0];
+    }
+    
+    // Otherwise search the objects in iteration order
     for (HCMapIterator i = HCMapIterationBegin(self); !HCMapIterationHasEnded(&i); HCMapIterationNext(&i)) {
         if (HCIsEqual(i.object, object)) {
+            HCRef key = i.key;
             HCMapIterationEnd(&i);
-            return true;
+            return key;
+        }
+    }
+    return NULL;
+}
+
+HCSetRef HCMapKeysForObjectRetained(HCMapRef self, HCRef object) {
+    HCSetRef keys = HCSetCreate();
+    
+    // Collect the keys from the value slot of the object when values are indexed
+    if (self->valueSlots != NULL) {
+        HCMapValueSlot* valueSlot = HCMapValueIndexFindSlotContainingObject(self, object);
+        if (valueSlot != NULL) {
+            HCRef* valueKeys = HCMapValueSlotKeys(valueSlot);
+            for (HCInteger keyIndex = 0; keyIndex < valueSlot->keyCount; keyIndex++) {
+                HCSetAddObject(keys, valueKeys[keyIndex]);
+            }
+        }
+        return keys;
+    }
+    
+    // Otherwise search all objects
+    for (HCMapIterator i = HCMapIterationBegin(self); !HCMapIterationHasEnded(&i); HCMapIterationNext(&i)) {
+        if (HCIsEqual(i.object, object)) {
+            HCSetAddObject(keys, i.key);
         }
     }
-    return false;
+    return keys;
 }
 
 HCRef HCMapFirstObject(HCMapRef self) {
@@ -148,41 +461,248 @@ HCRef HCMapLastObject(HCMapRef self) {
 }
 
 HCRef HCMapObjectAtIterationIndex(HCMapRef self, HCInteger index) {
-    return HCMapObjectForKey(self, HCMapKeyAtIterationIndex(self, index));
+    HCMapEntry* entry = HCMapEntryAtIterationIndex(self, index);
+    return entry == NULL ? NULL : entry->object;
 }
 
 HCRef HCMapObjectForKey(HCMapRef self, HCRef key) {
-    // TODO: How to avoid creating a pair just to do the comparison operation?
-    HCMapPairRef keyEmptyPair = HCMapPairCreate(key, NULL);
-    HCMapPairRef pair = HCSetObjectEqualToObject(self->pairs, keyEmptyPair);
-    HCRelease(keyEmptyPair);
-    return pair == NULL ? NULL : pair->object;
+    HCMapEntry* entry = NULL;
+    HCMapFindSlotContainingKey(self, key, NULL, NULL, &entry, NULL);
+    return entry == NULL ? NULL : entry->object;
 }
 
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Operations
 //----------------------------------------------------------------------------------------------------------------------------------
 void HCMapClear(HCMapRef self) {
-    HCSetClear(self->keys);
-    HCSetClear(self->pairs);
+    // Release all key and object references in all entries, mark all slots empty, and set count to zero
+    for (HCInteger entryIndex = 0; entryIndex < self->entryCount; entryIndex++) {
+        HCRelease(self->entries[entryIndex].key);
+        HCRelease(self->entries[entryIndex].object);
+    }
+    memset(self->slots, 0xFF, self->capacity * sizeof(HCInteger));
+    if (self->valueSlots != NULL) {
+        for (HCInteger slotIndex = 0; slotIndex < self->capacity; slotIndex++) {
+            free(self->valueSlots[slotIndex].keys);
+        }
+        memset(self->valueSlots, 0, self->capacity * sizeof(HCMapValueSlot));
+    }
+    free(self->liveCounts);
+    self->liveCounts = NULL;
+    self->entryCount = 0;
+    self->count = 0;
 }
 
 void HCMapAddObjectForKey(HCMapRef self, HCRef key, HCRef object) {
-    HCSetAddObjectReleased(self->pairs, HCMapPairCreate(key, object));
-    HCSetAddObject(self->keys, key);
+    // Find the slot containing an equal key, or the empty slot the key should occupy, keeping the hash of the key
+    HCInteger slotIndex = HCMapNotFound;
+    HCMapEntry* entry = NULL;
+    HCInteger keyHash = 0;
+    HCMapFindSlotContainingKey(self, key, &slotIndex, NULL, &entry, &keyHash);
+    if (slotIndex == HCMapNotFound) {
+        return;
+    }
+    
+    // Where an equal key was already found in the map, replace it and its associated object in place so they keep their iteration index
+    if (entry != NULL) {
+        HCRef previousKey = entry->key;
+        HCRef previousObject = entry->object;
+        HCInteger entryIndex = entry - self->entries;
+        HCMapValueIndexRemoveEntryAtIndex(self, entryIndex);
+        entry->key = HCRetain(key);
+        entry->object = HCRetain(object);
+        HCMapValueIndexAddEntryAtIndex(self, entryIndex);
+        HCRelease(previousKey);
+        HCRelease(previousObject);
+        return;
+    }
+    
+    // When the entries array is full, compact it if enough keys have been removed, otherwise expand and rehash
+    // NOTE: The empty slot the key should occupy must be found again, since rehashing moves slots
+    if (self->entryCount == self->entryCapacity) {
+        HCMapResize(self, self->count * 2 <= self->entryCount ? self->capacity : self->capacity * 2);
+        slotIndex = HCMapSlotIndexForHash(self, keyHash);
+        while (self->slots[slotIndex] != HCMapNotFound) {
+            slotIndex = (slotIndex + 1) & (self->capacity - 1);
+        }
+    }
+    
+    // Append the key and object to the entries and index them in their slot, counting them in the live counts while holes remain
+    if (self->liveCounts != NULL) {
+        HCMapLiveCountsAdd(self, self->entryCount, 1);
+    }
+    HCMapEntry* addedEntry = &self->entries[self->entryCount];
+    addedEntry->key = HCRetain(key);
+    addedEntry->object = HCRetain(object);
+    addedEntry->hash = keyHash;
+    self->slots[slotIndex] = self->entryCount;
+    HCMapValueIndexAddEntryAtIndex(self, self->entryCount);
+    self->entryCount++;
+    self->count++;
 }
 
 void HCMapRemoveObjectForKey(HCMapRef self, HCRef key) {
-    // TODO: How to avoid creating a pair just to do the comparison operation?
-    HCMapPairRef keyEmptyPair = HCMapPairCreate(key, NULL);
-    HCMapPairRef pair = HCSetRemoveObjectRetained(self->pairs, keyEmptyPair);
-    HCRelease(keyEmptyPair);
-    if (pair != NULL) {
-        HCSetRemoveObject(self->keys, pair->key);
-        HCRelease(pair);
+    // Find the slot containing the key
+    HCInteger slotIndex = HCMapNotFound;
+    HCBoolean found = false;
+    HCMapFindSlotContainingKey(self, key, &slotIndex, &found, NULL, NULL);
+    if (!found) {
+        return;
+    }
+    
+    // Remove the key and object, closing the gap in the probe sequence they leave behind
+    HCMapRemoveSlotAtIndex(self, slotIndex);
+    
+    // Contract and rehash when the map has become sparse, otherwise compact the entries once holes make up over a quarter of them
+    // NOTE: Compacting only when modifying the map keeps reading from it free of writes, so the map may be read from multiple threads
+    if (self->capacity > HCMapMinimumCapacityStatic && self->count * 4 < HCMapEntryCapacityForSlotCount(self->capacity)) {
+        HCMapResize(self, self->capacity / 2);
+    }
+    else if ((self->entryCount - self->count) * 4 > self->entryCount) {
+        HCMapCompact(self);
     }
 }
 
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Value Index
+//----------------------------------------------------------------------------------------------------------------------------------
+void HCMapValueIndexRebuild(HCMapRef self, HCMapValueSlot* previousSlots, HCInteger previousSlotCount) {
+    // Index each pair in the value slot array using its cached object hash
+    HCInteger mask = self->capacity - 1;
+    for (HCInteger previousSlotIndex = 0; previousSlotIndex < previousSlotCount; previousSlotIndex++) {
+        HCMapValueSlot* previousSlot = &previousSlots[previousSlotIndex];
+        if (previousSlot->object == NULL) {
+            continue;
+        }
+        HCInteger slotIndex = HCMapSlotIndexForHash(self, previousSlot->hash);
+        while (self->valueSlots[slotIndex].object != NULL) {
+            slotIndex = (slotIndex + 1) & mask;
+        }
+        self->valueSlots[slotIndex] = *previousSlot;
+    }
+}
+
+void HCMapValueIndexAddEntryAtIndex(HCMapRef self, HCInteger entryIndex) {
+    // Index non-null objects when values are indexed
+    HCMapEntry* entry = &self->entries[entryIndex];
+    if (self->valueSlots == NULL || entry->object == NULL) {
+        return;
+    }
+    
+    // Find the value slot of an equal object, or the empty value slot the object should occupy
+    // NOTE: There is always an empty value slot, since there is at most one value slot per entry
+    HCInteger objectHash = HCHashValue(entry->object);
+    HCInteger mask = self->capacity - 1;
+    HCMapValueSlot* valueSlot = NULL;
+    for (HCInteger slotIndex = HCMapSlotIndexForHash(self, objectHash); ; slotIndex = (slotIndex + 1) & mask) {
+        valueSlot = &self->valueSlots[slotIndex];
+        if (valueSlot->object == NULL || (valueSlot->hash == objectHash && HCIsEqual(valueSlot->object, entry->object))) {
+            break;
+        }
+    }
+    
+    // Occupy an empty value slot with the object and its key
+    // NOTE: The object and keys are borrowed from the entries, which hold them for as long as they are in the value index
+    if (valueSlot->object == NULL) {
+        *valueSlot = (HCMapValueSlot){ .object = entry->object, .hash = objectHash, .keyCount = 1, .keyCapacity = 1, .key = entry->key, .keys = NULL };
+        self->valueEntries[entryIndex] = (HCMapValueEntry){ .hash = objectHash, .keyIndex = 0 };
+        return;
+    }
+    
+    // Otherwise append the key to the keys of the equal object, moving the keys out of line once there are several
+    if (valueSlot->keyCount == valueSlot->keyCapacity) {
+        HCInteger keyCapacity = valueSlot->keyCapacity * 2;
+        HCRef* keys = realloc(valueSlot->keys, keyCapacity * sizeof(HCRef));
+        // TODO: Check that the allocation proceeded successfully, determine how to pass the error otherwise
+        if (valueSlot->keys == NULL) {
+            keys[0] = valueSlot->key;
+        }
+        valueSlot->keys = keys;
+        valueSlot->keyCapacity = keyCapacity;
+    }
+    valueSlot->keys[valueSlot->keyCount] = entry->key;
+    self->valueEntries[entryIndex] = (HCMapValueEntry){ .hash = objectHash, .keyIndex = valueSlot->keyCount };
+    valueSlot->keyCount++;
+}
+
+void HCMapValueIndexRemoveEntryAtIndex(HCMapRef self, HCInteger entryIndex) {
+    HCMapEntry* entry = &self->entries[entryIndex];
+    if (self->valueSlots == NULL || entry->object == NULL) {
+        return;
+    }
+    
+    // Find the value slot holding the key of the entry at the key index recorded for the entry, probing with the object hash recorded for it
+    // NOTE: The object is neither hashed nor compared, since it may have been mutated after it was added, changing its hash or equality
+    HCMapValueEntry* valueEntry = &self->valueEntries[entryIndex];
+    HCInteger mask = self->capacity - 1;
+    HCInteger holeIndex = HCMapSlotIndexForHash(self, valueEntry->hash);
+    for (; self->valueSlots[holeIndex].object != NULL; holeIndex = (holeIndex + 1) & mask) {
+        HCMapValueSlot* valueSlot = &self->valueSlots[holeIndex];
+        if (valueSlot->hash == valueEntry->hash && valueEntry->keyIndex < valueSlot->keyCount && HCMapValueSlotKeys(valueSlot)[valueEntry->keyIndex] == entry->key) {
+            break;
+        }
+    }
+    HCMapValueSlot* valueSlot = &self->valueSlots[holeIndex];
+    if (valueSlot->object == NULL) {
+        return;
+    }
+    
+    // Remove the key by moving the last key of the value slot into its place, recording the new key index in the entry of the moved key
+    HCRef* keys = HCMapValueSlotKeys(valueSlot);
+    valueSlot->keyCount--;
+    if (valueEntry->keyIndex != valueSlot->keyCount) {
+        HCRef movedKey = keys[valueSlot->keyCount];
+        keys[valueEntry->keyIndex] = movedKey;
+        HCMapEntry* movedEntry = NULL;
+        HCMapFindSlotContainingKey(self, movedKey, NULL, NULL, &movedEntry, NULL);
+        self->valueEntries[movedEntry - self->entries].keyIndex = valueEntry->keyIndex;
+    }
+    
+    // Borrow the object of another key when the object of the value slot is the one being removed, keeping the value slot while it has keys
+    if (valueSlot->keyCount > 0) {
+        if (valueSlot->object == entry->object) {
+            HCMapEntry* keyEntry = NULL;
+            HCMapFindSlotContainingKey(self, keys[0], NULL, NULL, &keyEntry, NULL);
+            valueSlot->object = keyEntry->object;
+        }
+        return;
+    }
+    free(valueSlot->keys);
+    
+    // Close the hole in the probe sequence by shifting back following value slots that are allowed to occupy it
+    for (HCInteger index = (holeIndex + 1) & mask; self->valueSlots[index].object != NULL; index = (index + 1) & mask) {
+        HCInteger idealIndex = HCMapSlotIndexForHash(self, self->valueSlots[index].hash);
+        if (((index - idealIndex) & mask) >= ((index - holeIndex) & mask)) {
+            self->valueSlots[holeIndex] = self->valueSlots[index];
+            holeIndex = index;
+        }
+    }
+    self->valueSlots[holeIndex] = (HCMapValueSlot){ .object = NULL, .hash = 0, .keyCount = 0, .keyCapacity = 0, .key = NULL, .keys = NULL };
+}
+
+HCMapValueSlot* HCMapValueIndexFindSlotContainingObject(HCMapRef self, HCRef object) {
+    // Report failure on requests to find the null object, since it is not equal to any object
+    if (object == NULL) {
+        return NULL;
+    }
+    
+    // Probe linearly from the ideal value slot index for the object, comparing cached hashes before checking equality
+    HCInteger objectHash = HCHashValue(object);
+    HCInteger mask = self->capacity - 1;
+    for (HCInteger slotIndex = HCMapSlotIndexForHash(self, objectHash); self->valueSlots[slotIndex].object != NULL; slotIndex = (slotIndex + 1) & mask) {
+        HCMapValueSlot* valueSlot = &self->valueSlots[slotIndex];
+        if (valueSlot->hash == objectHash && HCIsEqual(valueSlot->object, object)) {
+            return valueSlot;
+        }
+    }
+    return NULL;
+}
+
+HCRef* HCMapValueSlotKeys(HCMapValueSlot* valueSlot) {
+    // NOTE: The keys are resolved on each access rather than stored as a pointer to the inline key, since value slots move when rehashed
+    return valueSlot->keys == NULL ? &valueSlot->key : valueSlot->keys;
+}
+
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Memory Convenience Operations
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -215,81 +735,107 @@ HCRef HCMapRemoveObjectRetainedForKeyReleased(HCMapRef self, HCRef key) {
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Null-Terminated String Convenience Operations
 //----------------------------------------------------------------------------------------------------------------------------------
+// NOTE: Lookups use a string key borrowing the null-terminated string from the stack, so they neither allocate nor copy the key
 HCBoolean HCMapContainsCStringKey(HCMapRef self, const char* key) {
-    HCStringRef keyString = HCStringCreateWithCString(key);
-    HCBoolean contained = HCMapContainsKey(self, keyString);
-    HCRelease(keyString);
-    return contained;
+    HCString keyString = {0};
+    HCStringInitBorrowingCString(&keyString, key);
+    return HCMapContainsKey(self, &keyString);
 }
 
 HCRef HCMapObjectForCStringKey(HCMapRef self, const char* key) {
-    HCStringRef keyString = HCStringCreateWithCString(key);
-    HCRef object = HCMapObjectForKey(self, keyString);
-    HCRelease(keyString);
-    return object;
+    HCString keyString = {0};
+    HCStringInitBorrowingCString(&keyString, key);
+    return HCMapObjectForKey(self, &keyString);
 }
 
 void HCMapAddObjectForCStringKey(HCMapRef self, const char* key, HCRef object) {
-    HCStringRef keyString = HCStringCreateWithCString(key);
-    HCMapAddObjectForKey(self, keyString, object);
-    HCRelease(keyString);
+    // Replace the object associated with an existing equal key in place, which keeps the existing key string
+    HCString keyString = {0};
+    HCStringInitBorrowingCString(&keyString, key);
+    HCMapEntry* entry = NULL;
+    HCMapFindSlotContainingKey(self, &keyString, NULL, NULL, &entry, NULL);
+    if (entry != NULL) {
+        HCRef previousObject = entry->object;
+        HCInteger entryIndex = entry - self->entries;
+        HCMapValueIndexRemoveEntryAtIndex(self, entryIndex);
+        entry->object = HCRetain(object);
+        HCMapValueIndexAddEntryAtIndex(self, entryIndex);
+        HCRelease(previousObject);
+        return;
+    }
+    
+    // Otherwise the map requires a key string of its own
+    HCStringRef ownedKeyString = HCStringCreateWithCString(key);
+    HCMapAddObjectForKey(self, ownedKeyString, object);
+    HCRelease(ownedKeyString);
 }
 
 void HCMapRemoveObjectForCStringKey(HCMapRef self, const char* key) {
-    HCStringRef keyString = HCStringCreateWithCString(key);
-    HCMapRemoveObjectForKey(self, keyString);
-    HCRelease(keyString);
+    HCString keyString = {0};
+    HCStringInitBorrowingCString(&keyString, key);
+    HCMapRemoveObjectForKey(self, &keyString);
 }
 
 void HCMapAddObjectReleasedForCStringKey(HCMapRef self, const char* key, HCRef object) {
-    HCStringRef keyString = HCStringCreateWithCString(key);
-    HCMapAddObjectReleasedForKey(self, keyString, object);
-    HCRelease(keyString);
+    HCMapAddObjectForCStringKey(self, key, object);
+    HCRelease(object);
 }
 
 HCRef HCMapRemoveObjectRetainedForCStringKey(HCMapRef self, const char* key) {
-    HCStringRef keyString = HCStringCreateWithCString(key);
-    HCRef object = HCMapRemoveObjectRetainedForKey(self, keyString);
-    HCRelease(keyString);
-    return object;
+    HCString keyString = {0};
+    HCStringInitBorrowingCString(&keyString, key);
+    return HCMapRemoveObjectRetainedForKey(self, &keyString);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Iteration
 //----------------------------------------------------------------------------------------------------------------------------------
 HCInteger HCMapIteratorMinimumSizeRequiredForState() {
-    return sizeof(HCSetIterator);
+    return sizeof(HCMapEntry*);
 }
 
 HCMapIterator HCMapIterationBegin(HCMapRef self) {
-    HCSetIterator i = HCSetIterationBegin(self->pairs);
-    HCMapPairRef pair = i.object;
-
-    HCMapIterator iterator = {
-        .map = self,
-        .index = i.index,
-        .object = pair == NULL ? NULL : pair->object,
-        .key = pair == NULL ? NULL : pair->key,
-        .state = { 0 },
-    };
-    memcpy(&iterator.state, &i, sizeof(i));
+    // Iteration visits keys in insertion order, skipping holes left by removed keys
+    HCMapIterator iterator = HCMapIteratorInvalid;
+    iterator.map = self;
+    if (self->count == 0) {
+        HCMapIterationEnd(&iterator);
+        return iterator;
+    }
+    
+    // Prepare the iterator at the first entry containing a key, recording the entry in the iterator state
+    HCMapEntry* entry = &self->entries[0];
+    while (entry->key == NULL) {
+        entry++;
+    }
+    *(HCMapEntry**)&iterator.state = entry;
+    iterator.index = 0;
+    iterator.key = entry->key;
+    iterator.object = entry->object;
     return iterator;
 }
 
 void HCMapIterationNext(HCMapIterator* iterator) {
-    HCSetIterator* pairIterator = (HCSetIterator*)&iterator->state;
-    HCSetIterationNext(pairIterator);
-    HCMapPairRef pair = pairIterator->object;
-    iterator->index = pairIterator->index;
-    iterator->object = pair == NULL ? NULL : pair->object;
-    iterator->key = pair == NULL ? NULL : pair->key;
-    if (iterator->key == NULL || iterator->object == NULL) {
+    // End iteration when moving past the last entry
+    if (!HCMapIterationHasNext(iterator)) {
         HCMapIterationEnd(iterator);
+        return;
     }
+    
+    // Move to the entry containing a key following the entry of the current iteration result
+    HCMapEntry** entryState = (HCMapEntry**)&iterator->state;
+    HCMapEntry* entry = *entryState + 1;
+    while (entry->key == NULL) {
+        entry++;
+    }
+    *entryState = entry;
+    iterator->index++;
+    iterator->key = entry->key;
+    iterator->object = entry->object;
 }
 
 void HCMapIterationEnd(HCMapIterator* iterator) {
-    iterator->index = HCMapCount(iterator->map);
+    iterator->index = iterator->map == NULL ? 0 : HCMapCount(iterator->map);
     iterator->object = NULL;
     iterator->key = NULL;
     memset(&iterator->state, 0, HCMapIteratorStateSizeStatic * sizeof(HCByte));
@@ -300,58 +846,9 @@ HCBoolean HCMapIterationHasBegun(HCMapIterator* iterator) {
 }
 
 HCBoolean HCMapIterationHasNext(HCMapIterator* iterator) {
-    HCSetIterator* pairIterator = (HCSetIterator*)&iterator->state;
-    return HCSetIterationHasNext(pairIterator);
+    return iterator->map != NULL && iterator->key != NULL && iterator->index < HCMapCount(iterator->map) - 1;
 }
 
 HCBoolean HCMapIterationHasEnded(HCMapIterator* iterator) {
-    return HCMapIterationHasBegun(iterator) && (iterator->map == NULL || iterator->key == NULL || iterator->object == NULL);
-}
-
-//----------------------------------------------------------------------------------------------------------------------------------
-// MARK: - Pair Object Type
-//----------------------------------------------------------------------------------------------------------------------------------
-const HCObjectTypeData HCMapPairTypeDataInstance = {
-    .base = {
-        .ancestor = &HCObjectTypeDataInstance.base,
-        .name = "HCMapPair",
-    },
-    .isEqual = (void*)HCMapPairIsEqual,
-    .hashValue = (void*)HCMapPairHashValue,
-    .print = (void*)HCObjectPrint,
-    .destroy = (void*)HCMapPairDestroy,
-};
-HCType HCMapPairType = (HCType)&HCMapPairTypeDataInstance;
-
-//----------------------------------------------------------------------------------------------------------------------------------
-// MARK: - Pair Construction
-//----------------------------------------------------------------------------------------------------------------------------------
-HCMapPairRef HCMapPairCreate(HCRef key, HCRef object) {
-    HCMapPairRef self = calloc(sizeof(HCMapPair), 1);
-    HCMapPairInit(self, key, object);
-    return self;
-}
-
-void HCMapPairInit(void* memory, HCRef key, HCRef object) {
-    HCObjectInit(memory);
-    HCMapPairRef self = memory;
-    self->key = HCRetain(key);
-    self->object = HCRetain(object);
-    self->base.type = HCMapPairType;
-}
-
-void HCMapPairDestroy(HCMapPairRef self) {
-    HCRelease(self->key);
-    HCRelease(self->object);
-}
-
-//----------------------------------------------------------------------------------------------------------------------------------
-// MARK: - Pair Object Polymorphic Functions
-//----------------------------------------------------------------------------------------------------------------------------------
-HCBoolean HCMapPairIsEqual(HCMapPairRef self, HCMapPairRef other) {
-    return HCIsEqual(self->key, other->key);
-}
-
-HCInteger HCMapPairHashValue(HCMapPairRef self) {
-    return HCHashValue(self->key);
+    return HCMapIterationHasBegun(iterator) && (iterator->map == NULL || iterator->key == NULL);
 }
@@ -12,6 +12,8 @@
 #ifndef HCMap_h
 #define HCMap_h
 
+#include "HCSet.h"
+
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Object Type
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -29,6 +31,17 @@ typedef struct HCMap* HCMapRef;
 /// An index value indicating an unsuccessful search.
 extern const HCInteger HCMapNotFound;
 
+/// Options that can be applied to a map to change its behavior.
+typedef enum HCMapOption {
+    /// The @a HCMapOption value representing the absence of other options.
+    HCMapOptionNone = 0b0,
+    
+    /// When this option is set the map maintains an index of its objects in addition to its keys.
+    ///
+    /// The index makes @c HCMapContainsObject(), @c HCMapKeyForObject(), and @c HCMapKeysForObjectRetained() constant time on average, at the cost of hashing each object added to the map and additional memory.
+    HCMapOptionIndexValues = 0b1,
+} HCMapOption;
+
 /// Structure used to track iteration over the contents of a map.
 typedef struct HCMapIterator {
     #define HCMapIteratorStateSizeStatic (4 * sizeof(HCInteger))
@@ -67,6 +80,13 @@ HCMapRef HCMapCreate(void);
 ///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
 HCMapRef HCMapCreateWithCapacity(HCInteger capacity);
 
+/// Creates an empty map with options.
+/// @param capacity The initial capacity of the created map.
+/// @param options A bitmask of @c HCMapOption values that should be enabled on the map.
+/// @returns A reference to the created map.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCMapRef HCMapCreateWithOptions(HCInteger capacity, HCMapOption options);
+
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Object Polymorphic Functions
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -101,6 +121,11 @@ HCBoolean HCMapIsEmpty(HCMapRef self);
 /// @returns The map key count. Objects are associated with each key.
 HCInteger HCMapCount(HCMapRef self);
 
+/// Obtains the options set on the map.
+/// @param self A reference to the map.
+/// @returns The map options provided when the map was created.
+HCMapOption HCMapOptions(HCMapRef self);
+
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Searching
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -133,6 +158,20 @@ HCRef HCMapKeyAtIterationIndex(HCMapRef self, HCInteger index);
 /// @returns @c true if an object in the map returned @c true to a call to @c HCIsEqual() with @c object. Otherwise returns @c false.
 HCBoolean HCMapContainsObject(HCMapRef self, HCRef object);
 
+/// Obtains a key associated with an object in a map.
+/// @param self A reference to the map.
+/// @param object The object to search for.
+/// @returns A key associated with an object in the map equal to @c object by @c HCIsEqual() if one exists. Otherwise returns @c NULL.
+///     When several keys are associated with equal objects, which of them is returned is unspecified.
+HCRef HCMapKeyForObject(HCMapRef self, HCRef object);
+
+/// Obtains all keys associated with an object in a map.
+/// @param self A reference to the map.
+/// @param object The object to search for.
+/// @returns A set of the keys associated with objects in the map equal to @c object by @c HCIsEqual(). If no such keys exist, the set is empty.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCSetRef HCMapKeysForObjectRetained(HCMapRef self, HCRef object);
+
 /// Obtains the object associated with the key at the first iteration index in a map.
 /// @param self A reference to the map.
 /// @returns The object associated with the key at the first iteration index in the map. This function will return the same object when called unless the map is modified. If the map is empty, returns @c NULL.
@@ -12,46 +12,93 @@
 
 #include "../Core/HCObject_Internal.h"
 #include "HCMap.h"
-#include "HCSet.h"
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Definitions
+//----------------------------------------------------------------------------------------------------------------------------------
+#define HCMapMinimumCapacityStatic (8)
+#define HCMapLoadFactorNumeratorStatic (3)
+#define HCMapLoadFactorDenominatorStatic (4)
+
+typedef struct HCMapEntry {
+    HCRef key;
+    HCRef object;
+    HCInteger hash;
+} HCMapEntry;
+
+typedef struct HCMapValueSlot {
+    HCRef object;
+    HCInteger hash;
+    HCInteger keyCount;
+    HCInteger keyCapacity;
+    HCRef key;
+    HCRef* keys;
+} HCMapValueSlot;
+
+typedef struct HCMapValueEntry {
+    HCInteger hash;
+    HCInteger keyIndex;
+} HCMapValueEntry;
 
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Object Type
 //----------------------------------------------------------------------------------------------------------------------------------
+// NOTE: Keys and objects are stored in insertion order in the dense entries array, while the slots array is an open-addressing index into it.
+//       Removed keys leave holes in the entries array, which readers skip. Holes are compacted when the map is modified, once they
+//       make up over a quarter of the entries or when the map is resized.
+//       While holes remain, the live counts form a Fenwick tree over the entries counting the keys they hold, which finds the entry at an
+//       iteration index in logarithmic time. They are built when the first hole not at the end of the entries is left, and discarded on compaction.
+//       When values are indexed, the value slots form a second open-addressing table with the same slot count, holding one slot per distinct
+//       object with the keys associated with it. A single key is held inline, and several keys are held in an array the value slot owns.
+//       The value entries parallel the entries, recording the object hash cached when each entry was indexed and the index of its key
+//       among the keys of its value slot, so removing an entry neither hashes nor compares its object, which may have been mutated since.
 typedef struct HCMap {
     HCObject base;
-    HCSetRef keys;
-    HCSetRef pairs;
+    HCMapOption options;
+    HCInteger count;
+    HCInteger capacity;
+    HCInteger* slots;
+    HCInteger entryCount;
+    HCInteger entryCapacity;
+    HCMapEntry* entries;
+    HCInteger* liveCounts;
+    HCMapValueSlot* valueSlots;
+    HCMapValueEntry* valueEntries;
 } HCMap;
 
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Construction
 //----------------------------------------------------------------------------------------------------------------------------------
-void HCMapInit(void* memory, HCInteger capacity);
+void HCMapInit(void* memory, HCInteger capacity, HCMapOption options);
 void HCMapDestroy(HCMapRef self);
 
 //----------------------------------------------------------------------------------------------------------------------------------
-// MARK: - Pair Object Type
+// MARK: - Storage
 //----------------------------------------------------------------------------------------------------------------------------------
-typedef struct HCMapPair {
-    HCObject base;
-    HCRef key;
-    HCRef object;
-} HCMapPair;
-extern HCType HCMapPairType;
-typedef struct HCMapPair* HCMapPairRef;
+HCInteger HCMapSlotCountForCapacity(HCInteger capacity);
+HCInteger HCMapEntryCapacityForSlotCount(HCInteger slotCount);
+HCInteger HCMapSlotIndexForHash(HCMapRef self, HCInteger hash);
+void HCMapResize(HCMapRef self, HCInteger slotCount);
+void HCMapCompact(HCMapRef self);
+void HCMapLiveCountsBuild(HCMapRef self);
+void HCMapLiveCountsAdd(HCMapRef self, HCInteger entryIndex, HCInteger delta);
+HCInteger HCMapLiveCountsFindEntryIndex(HCMapRef self, HCInteger index);
+void HCMapRemoveSlotAtIndex(HCMapRef self, HCInteger slotIndex);
 
 //----------------------------------------------------------------------------------------------------------------------------------
-// MARK: - Pair Construction
+// MARK: - Searching
 //----------------------------------------------------------------------------------------------------------------------------------
-HCMapPairRef HCMapPairCreate(HCRef key, HCRef object);
-void HCMapPairInit(void* memory, HCRef key, HCRef object);
-void HCMapPairDestroy(HCMapPairRef self);
+void HCMapFindSlotContainingKey(HCMapRef self, HCRef key, HCInteger* keySlotIndex, HCBoolean* found, HCMapEntry** resultEntry, HCInteger* keyHashValue);
+HCMapEntry* HCMapEntryAtIterationIndex(HCMapRef self, HCInteger index);
 
 //----------------------------------------------------------------------------------------------------------------------------------
-// MARK: - Pair Object Polymorphic Functions
+// MARK: - Value Index
 //----------------------------------------------------------------------------------------------------------------------------------
-HCBoolean HCMapPairIsEqual(HCMapPairRef self, HCMapPairRef other);
-HCInteger HCMapPairHashValue(HCMapPairRef self);
+void HCMapValueIndexRebuild(HCMapRef self, HCMapValueSlot* previousSlots, HCInteger previousSlotCount);
+void HCMapValueIndexAddEntryAtIndex(HCMapRef self, HCInteger entryIndex);
+void HCMapValueIndexRemoveEntryAtIndex(HCMapRef self, HCInteger entryIndex);
+HCMapValueSlot* HCMapValueIndexFindSlotContainingObject(HCMapRef self, HCRef object);
+HCRef* HCMapValueSlotKeys(HCMapValueSlot* valueSlot);
 
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Iteration
@@ -0,0 +1,416 @@
+///
+/// @file HCPersistentList.c
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#include "HCPersistentList_Internal.h"
+#include "HCList_Internal.h"
+#include <string.h>
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Type
+//----------------------------------------------------------------------------------------------------------------------------------
+const HCObjectTypeData HCPersistentListTypeDataInstance = {
+    .base = {
+        .ancestor = &HCObjectTypeDataInstance.base,
+        .name = "HCPersistentList",
+        .identifier = HCTypeIdentifierPersistentList,
+        .kindMask = HCTypeKindMaskForIdentifier(HCTypeIdentifierObject) | HCTypeKindMaskForIdentifier(HCTypeIdentifierPersistentList),
+    },
+    .isEqual = (void*)HCPersistentListIsEqual,
+    .hashValue = (void*)HCPersistentListHashValue,
+    .print = (void*)HCPersistentListPrint,
+    .destroy = (void*)HCPersistentListDestroy,
+};
+HCType HCPersistentListType = (HCType)&HCPersistentListTypeDataInstance;
+
+const HCObjectTypeData HCPersistentListNodeTypeDataInstance = {
+    .base = {
+        .ancestor = &HCObjectTypeDataInstance.base,
+        .name = "HCPersistentListNode",
+        .identifier = HCTypeIdentifierPersistentListNode,
+        .kindMask = HCTypeKindMaskForIdentifier(HCTypeIdentifierObject) | HCTypeKindMaskForIdentifier(HCTypeIdentifierPersistentListNode),
+    },
+    .isEqual = (void*)HCObjectIsEqual,
+    .hashValue = (void*)HCObjectHashValue,
+    .print = (void*)HCObjectPrint,
+    .destroy = (void*)HCPersistentListNodeDestroy,
+};
+HCType HCPersistentListNodeType = (HCType)&HCPersistentListNodeTypeDataInstance;
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Nodes
+//----------------------------------------------------------------------------------------------------------------------------------
+HCPersistentListNodeRef HCPersistentListNodeCreateCopy(HCPersistentListNodeRef node) {
+    HCPersistentListNodeRef self = HCObjectAllocate(sizeof(HCPersistentListNode));
+    HCPersistentListNodeInit(self, node);
+    return self;
+}
+
+void HCPersistentListNodeInit(void* memory, HCPersistentListNodeRef node) {
+    HCObjectInit(memory);
+    HCPersistentListNodeRef self = memory;
+    self->base.type = HCPersistentListNodeType;
+    if (node == NULL) {
+        memset(self->children, 0, sizeof(self->children));
+        return;
+    }
+    memcpy(self->children, node->children, sizeof(self->children));
+    HCRetainArray(self->children, HCPersistentListBranchCountStatic);
+}
+
+void HCPersistentListNodeDestroy(HCPersistentListNodeRef self) {
+    HCReleaseArray(self->children, HCPersistentListBranchCountStatic);
+}
+
+/// Replaces a child of a node that has not yet been shared, taking ownership of the new child.
+static void HCPersistentListNodeReplaceChild(HCPersistentListNodeRef self, HCInteger childIndex, HCRef child) {
+    HCRelease(self->children[childIndex]);
+    self->children[childIndex] = child;
+}
+
+/// Creates a chain of branch nodes leading down to a node.
+/// @param level The level of the top of the chain, in bits of index consumed below it.
+/// @param node The node at the bottom of the chain, which is owned by the created chain.
+/// @returns The top node of the chain, which is @c node itself if @c level is zero.
+static HCPersistentListNodeRef HCPersistentListNodeCreatePath(HCInteger level, HCPersistentListNodeRef node) {
+    if (level == 0) {
+        return node;
+    }
+    HCPersistentListNodeRef path = HCPersistentListNodeCreateCopy(NULL);
+    path->children[0] = HCPersistentListNodeCreatePath(level - HCPersistentListBranchBitsStatic, node);
+    return path;
+}
+
+/// Creates a copy of a subtree with a full leaf added at an index, copying only the nodes on the path to the leaf.
+/// @param level The level of @c node.
+/// @param node The root of the subtree to copy.
+/// @param index The index of the first element of the leaf.
+/// @param leaf The leaf to add, which is retained by the created subtree.
+/// @returns The root of the created subtree.
+static HCPersistentListNodeRef HCPersistentListNodeCreateByAddingLeaf(HCInteger level, HCPersistentListNodeRef node, HCInteger index, HCPersistentListNodeRef leaf) {
+    HCPersistentListNodeRef copy = HCPersistentListNodeCreateCopy(node);
+    HCInteger childIndex = (index >> level) & HCPersistentListBranchMaskStatic;
+    HCPersistentListNodeRef child = node->children[childIndex];
+    if (level == HCPersistentListBranchBitsStatic) {
+        HCPersistentListNodeReplaceChild(copy, childIndex, HCRetain(leaf));
+    }
+    else if (child != NULL) {
+        HCPersistentListNodeReplaceChild(copy, childIndex, HCPersistentListNodeCreateByAddingLeaf(level - HCPersistentListBranchBitsStatic, child, index, leaf));
+    }
+    else {
+        HCPersistentListNodeReplaceChild(copy, childIndex, HCPersistentListNodeCreatePath(level - HCPersistentListBranchBitsStatic, HCRetain(leaf)));
+    }
+    return copy;
+}
+
+/// Creates a copy of a subtree with the element at an index replaced, copying only the nodes on the path to the element.
+/// @param level The level of @c node.
+/// @param node The root of the subtree to copy.
+/// @param index The index of the element to replace.
+/// @param object The object to replace the element with, which is retained by the created subtree.
+/// @returns The root of the created subtree.
+static HCPersistentListNodeRef HCPersistentListNodeCreateByReplacingObject(HCInteger level, HCPersistentListNodeRef node, HCInteger index, HCRef object) {
+    HCPersistentListNodeRef copy = HCPersistentListNodeCreateCopy(node);
+    HCInteger childIndex = (index >> level) & HCPersistentListBranchMaskStatic;
+    if (level == 0) {
+        HCPersistentListNodeReplaceChild(copy, childIndex, HCRetain(object));
+    }
+    else {
+        HCPersistentListNodeReplaceChild(copy, childIndex, HCPersistentListNodeCreateByReplacingObject(level - HCPersistentListBranchBitsStatic, node->children[childIndex], index, object));
+    }
+    return copy;
+}
+
+/// Creates a copy of a subtree with its last leaf removed, copying only the nodes on the path to the leaf.
+/// @param level The level of @c node.
+/// @param node The root of the subtree to copy.
+/// @param index The index of the first element of the last leaf.
+/// @returns The root of the created subtree, or @c NULL if the subtree contains no other leaves.
+static HCPersistentListNodeRef HCPersistentListNodeCreateByRemovingLeaf(HCInteger level, HCPersistentListNodeRef node, HCInteger index) {
+    HCInteger childIndex = (index >> level) & HCPersistentListBranchMaskStatic;
+    HCPersistentListNodeRef child = NULL;
+    if (level > HCPersistentListBranchBitsStatic) {
+        child = HCPersistentListNodeCreateByRemovingLeaf(level - HCPersistentListBranchBitsStatic, node->children[childIndex], index);
+    }
+    if (child == NULL && childIndex == 0) {
+        return NULL;
+    }
+    HCPersistentListNodeRef copy = HCPersistentListNodeCreateCopy(node);
+    HCPersistentListNodeReplaceChild(copy, childIndex, child);
+    return copy;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Storage
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Determines the index of the first element in the tail of a list.
+static HCInteger HCPersistentListTailIndex(HCPersistentListRef self) {
+    return self->count == 0 ? 0 : ((self->count - 1) >> HCPersistentListBranchBitsStatic) << HCPersistentListBranchBitsStatic;
+}
+
+/// Finds the leaf of a list that contains the element at an index.
+static HCPersistentListNodeRef HCPersistentListLeafForIndex(HCPersistentListRef self, HCInteger index) {
+    if (index >= HCPersistentListTailIndex(self)) {
+        return self->tail;
+    }
+    HCPersistentListNodeRef node = self->root;
+    for (HCInteger level = self->shift; level > 0; level -= HCPersistentListBranchBitsStatic) {
+        node = node->children[(index >> level) & HCPersistentListBranchMaskStatic];
+    }
+    return node;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Construction
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Creates a list from its storage.
+/// @param count The number of elements in the list.
+/// @param shift The level of @c root.
+/// @param root The root of the trie, which is owned by the created list.
+/// @param tail The tail leaf, which is owned by the created list.
+/// @returns A reference to the created list.
+static HCPersistentListRef HCPersistentListCreateWithStorage(HCInteger count, HCInteger shift, HCPersistentListNodeRef root, HCPersistentListNodeRef tail) {
+    HCPersistentListRef self = HCObjectAllocate(sizeof(HCPersistentList));
+    HCPersistentListInit(self, count, shift, root, tail);
+    return self;
+}
+
+HCPersistentListRef HCPersistentListCreate(void) {
+    return HCPersistentListCreateWithStorage(0, HCPersistentListBranchBitsStatic, HCPersistentListNodeCreateCopy(NULL), HCPersistentListNodeCreateCopy(NULL));
+}
+
+HCPersistentListRef HCPersistentListCreateWithList(HCListRef list) {
+    // Fill leaves from the list and place them in the trie directly, since its nodes are not yet shared
+    HCInteger count = list->count;
+    HCInteger shift = HCPersistentListBranchBitsStatic;
+    HCPersistentListNodeRef root = HCPersistentListNodeCreateCopy(NULL);
+    HCInteger tailIndex = count == 0 ? 0 : ((count - 1) >> HCPersistentListBranchBitsStatic) << HCPersistentListBranchBitsStatic;
+    for (HCInteger index = 0; index < tailIndex; index += HCPersistentListBranchCountStatic) {
+        HCPersistentListNodeRef leaf = HCPersistentListNodeCreateCopy(NULL);
+        memcpy(leaf->children, list->objects + index, sizeof(leaf->children));
+        HCRetainArray(leaf->children, HCPersistentListBranchCountStatic);
+
+        // Add a level to the trie when it is full
+        if (index >= (HCInteger)1 << (shift + HCPersistentListBranchBitsStatic)) {
+            HCPersistentListNodeRef node = HCPersistentListNodeCreateCopy(NULL);
+            node->children[0] = root;
+            root = node;
+            shift += HCPersistentListBranchBitsStatic;
+        }
+
+        // Descend to the leaf's slot, creating branch nodes as needed
+        HCPersistentListNodeRef node = root;
+        for (HCInteger level = shift; level > HCPersistentListBranchBitsStatic; level -= HCPersistentListBranchBitsStatic) {
+            HCInteger childIndex = (index >> level) & HCPersistentListBranchMaskStatic;
+            if (node->children[childIndex] == NULL) {
+                node->children[childIndex] = HCPersistentListNodeCreateCopy(NULL);
+            }
+            node = node->children[childIndex];
+        }
+        node->children[(index >> HCPersistentListBranchBitsStatic) & HCPersistentListBranchMaskStatic] = leaf;
+    }
+
+    // Fill the tail with the remaining elements
+    HCPersistentListNodeRef tail = HCPersistentListNodeCreateCopy(NULL);
+    memcpy(tail->children, list->objects + tailIndex, (count - tailIndex) * sizeof(HCRef));
+    HCRetainArray(tail->children, count - tailIndex);
+    return HCPersistentListCreateWithStorage(count, shift, root, tail);
+}
+
+HCPersistentListRef HCPersistentListCreateByAddingObject(HCPersistentListRef self, HCRef object) {
+    // Add the object to a copy of the tail if it has room
+    HCInteger tailIndex = HCPersistentListTailIndex(self);
+    HCInteger tailCount = self->count - tailIndex;
+    if (tailCount < HCPersistentListBranchCountStatic) {
+        HCPersistentListNodeRef tail = HCPersistentListNodeCreateCopy(self->tail);
+        tail->children[tailCount] = HCRetain(object);
+        return HCPersistentListCreateWithStorage(self->count + 1, self->shift, HCRetain(self->root), tail);
+    }
+
+    // Move the full tail into the trie, adding a level to the trie if it is full
+    HCInteger shift = self->shift;
+    HCPersistentListNodeRef root = NULL;
+    if (tailIndex >= (HCInteger)1 << (shift + HCPersistentListBranchBitsStatic)) {
+        root = HCPersistentListNodeCreateCopy(NULL);
+        root->children[0] = HCRetain(self->root);
+        root->children[1] = HCPersistentListNodeCreatePath(shift, HCRetain(self->tail));
+        shift += HCPersistentListBranchBitsStatic;
+    }
+    else {
+        root = HCPersistentListNodeCreateByAddingLeaf(shift, self->root, tailIndex, self->tail);
+    }
+
+    // Start a new tail with the object
+    HCPersistentListNodeRef tail = HCPersistentListNodeCreateCopy(NULL);
+    tail->children[0] = HCRetain(object);
+    return HCPersistentListCreateWithStorage(self->count + 1, shift, root, tail);
+}
+
+HCPersistentListRef HCPersistentListCreateByRemovingObject(HCPersistentListRef self) {
+    if (self->count <= 1) {
+        return HCPersistentListCreate();
+    }
+
+    // Remove the object from a copy of the tail if it has other objects
+    HCInteger tailIndex = HCPersistentListTailIndex(self);
+    HCInteger tailCount = self->count - tailIndex;
+    if (tailCount > 1) {
+        HCPersistentListNodeRef tail = HCPersistentListNodeCreateCopy(self->tail);
+        HCPersistentListNodeReplaceChild(tail, tailCount - 1, NULL);
+        return HCPersistentListCreateWithStorage(self->count - 1, self->shift, HCRetain(self->root), tail);
+    }
+
+    // Move the last leaf of the trie into the tail, removing a level from the trie if its root has a single child
+    HCPersistentListNodeRef tail = HCRetain(HCPersistentListLeafForIndex(self, self->count - 2));
+    HCPersistentListNodeRef root = HCPersistentListNodeCreateByRemovingLeaf(self->shift, self->root, self->count - 2);
+    HCInteger shift = self->shift;
+    if (root == NULL) {
+        root = HCPersistentListNodeCreateCopy(NULL);
+    }
+    if (shift > HCPersistentListBranchBitsStatic && root->children[1] == NULL) {
+        HCPersistentListNodeRef child = HCRetain(root->children[0]);
+        HCRelease(root);
+        root = child;
+        shift -= HCPersistentListBranchBitsStatic;
+    }
+    return HCPersistentListCreateWithStorage(self->count - 1, shift, root, tail);
+}
+
+HCPersistentListRef HCPersistentListCreateByReplacingObjectAtIndex(HCPersistentListRef self, HCInteger index, HCRef object) {
+    // NOTE: Since persistent lists are immutable, an unchanged list can be shared rather than copied
+    if (!HCPersistentListContainsIndex(self, index)) {
+        return HCRetain(self);
+    }
+    if (index >= HCPersistentListTailIndex(self)) {
+        HCPersistentListNodeRef tail = HCPersistentListNodeCreateCopy(self->tail);
+        HCPersistentListNodeReplaceChild(tail, index & HCPersistentListBranchMaskStatic, HCRetain(object));
+        return HCPersistentListCreateWithStorage(self->count, self->shift, HCRetain(self->root), tail);
+    }
+    HCPersistentListNodeRef root = HCPersistentListNodeCreateByReplacingObject(self->shift, self->root, index, object);
+    return HCPersistentListCreateWithStorage(self->count, self->shift, root, HCRetain(self->tail));
+}
+
+void HCPersistentListInit(void* memory, HCInteger count, HCInteger shift, HCPersistentListNodeRef root, HCPersistentListNodeRef tail) {
+    HCObjectInit(memory);
+    HCPersistentListRef self = memory;
+    self->base.type = HCPersistentListType;
+    self->count = count;
+    self->shift = shift;
+    self->root = root;
+    self->tail = tail;
+}
+
+void HCPersistentListDestroy(HCPersistentListRef self) {
+    HCRelease(self->root);
+    HCRelease(self->tail);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Polymorphic Functions
+//----------------------------------------------------------------------------------------------------------------------------------
+HCBoolean HCPersistentListIsEqual(HCPersistentListRef self, HCPersistentListRef other) {
+    if (self->count != other->count) {
+        return false;
+    }
+    for (HCInteger index = 0; index < self->count; index += HCPersistentListBranchCountStatic) {
+        // Skip comparing leaves shared by both lists
+        HCPersistentListNodeRef leaf = HCPersistentListLeafForIndex(self, index);
+        HCPersistentListNodeRef otherLeaf = HCPersistentListLeafForIndex(other, index);
+        if (leaf == otherLeaf) {
+            continue;
+        }
+        HCInteger leafCount = self->count - index < HCPersistentListBranchCountStatic ? self->count - index : HCPersistentListBranchCountStatic;
+        for (HCInteger childIndex = 0; childIndex < leafCount; childIndex++) {
+            if (!HCIsEqual(leaf->children[childIndex], otherLeaf->children[childIndex])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+HCInteger HCPersistentListHashValue(HCPersistentListRef self) {
+    // NOTE: The hash is accumulated unsigned so it wraps on overflow, giving the same value as HCListHashValue()
+    uint64_t hash = 5381;
+    for (HCInteger index = 0; index < self->count; index++) {
+        HCRef object = HCPersistentListObjectAtIndex(self, index);
+        uint64_t objectHash = (uint64_t)HCHashValue(object);
+        hash = ((hash << 5) + hash) + objectHash;
+    }
+    return (HCInteger)hash;
+}
+
+void HCPersistentListPrint(HCPersistentListRef self, FILE* stream) {
+    fprintf(stream, "[");
+    for (HCInteger index = 0; index < self->count; index++) {
+        HCRef object = HCPersistentListObjectAtIndex(self, index);
+        HCPrint(object, stream);
+        if (index != self->count - 1) {
+            fprintf(stream, ",");
+        }
+    }
+    fprintf(stream, "]");
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Content
+//----------------------------------------------------------------------------------------------------------------------------------
+HCBoolean HCPersistentListIsEmpty(HCPersistentListRef self) {
+    return HCPersistentListCount(self) == 0;
+}
+
+HCInteger HCPersistentListCount(HCPersistentListRef self) {
+    return self->count;
+}
+
+HCBoolean HCPersistentListContainsIndex(HCPersistentListRef self, HCInteger index) {
+    return index >= 0 && index < self->count;
+}
+
+HCRef HCPersistentListFirstObject(HCPersistentListRef self) {
+    return HCPersistentListObjectAtIndex(self, 0);
+}
+
+HCRef HCPersistentListLastObject(HCPersistentListRef self) {
+    return HCPersistentListObjectAtIndex(self, self->count - 1);
+}
+
+HCRef HCPersistentListObjectAtIndex(HCPersistentListRef self, HCInteger index) {
+    if (!HCPersistentListContainsIndex(self, index)) {
+        return NULL;
+    }
+    return HCPersistentListLeafForIndex(self, index)->children[index & HCPersistentListBranchMaskStatic];
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Conversion
+//----------------------------------------------------------------------------------------------------------------------------------
+HCListRef HCPersistentListCreateList(HCPersistentListRef self) {
+    HCListRef list = HCListCreateWithCapacity(self->count > 0 ? self->count : 1);
+    for (HCInteger index = 0; index < self->count; index += HCPersistentListBranchCountStatic) {
+        HCInteger leafCount = self->count - index < HCPersistentListBranchCountStatic ? self->count - index : HCPersistentListBranchCountStatic;
+        HCListAddObjects(list, index, HCPersistentListLeafForIndex(self, index)->children, leafCount);
+    }
+    return list;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Iteration
+//----------------------------------------------------------------------------------------------------------------------------------
+void HCPersistentListForEach(HCPersistentListRef self, HCPersistentListForEachFunction forEachFunction, void* context) {
+    // Visit the elements a leaf at a time, rather than finding the leaf of each element
+    for (HCInteger index = 0; index < self->count; index += HCPersistentListBranchCountStatic) {
+        HCPersistentListNodeRef leaf = HCPersistentListLeafForIndex(self, index);
+        HCInteger leafCount = self->count - index < HCPersistentListBranchCountStatic ? self->count - index : HCPersistentListBranchCountStatic;
+        for (HCInteger childIndex = 0; childIndex < leafCount; childIndex++) {
+            forEachFunction(context, self, index + childIndex, leaf->children[childIndex]);
+        }
+    }
+}
@@ -0,0 +1,154 @@
+///
+/// @file HCPersistentList.h
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+/// @brief Immutable collection of ordered, non-exclusive object elements that shares storage with the lists it is derived from.
+///
+
+#ifndef HCPersistentList_h
+#define HCPersistentList_h
+
+#include "../Core/HCObject.h"
+#include "HCList.h"
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Type
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Type of @c HCPersistentList instances.
+extern HCType HCPersistentListType;
+
+/// A reference to an @c HCPersistentList instance.
+typedef struct HCPersistentList* HCPersistentListRef;
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Other Definitions
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Function operating on a value of a persistent list during a for-each iteration over the list.
+/// @param context The unmodified context value provided to @c HCPersistentListForEach().
+/// @param list The subject list of the iteration.
+/// @param index The current iteration index of the iteration.
+/// @param object The object at the current iteration index.
+typedef void (*HCPersistentListForEachFunction)(void* context, HCPersistentListRef list, HCInteger index, HCRef object);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Construction
+//----------------------------------------------------------------------------------------------------------------------------------
+// NOTE: Persistent lists are never modified after creation. Lists created from another persistent list share all storage not
+//       affected by the change with it, so creating a changed list takes O(log n) time and memory, and the original list remains
+//       valid and unchanged. Since they are immutable, persistent lists may be read from multiple threads without locking.
+
+/// Creates an empty persistent list.
+/// @returns A reference to the created list.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCPersistentListRef HCPersistentListCreate(void);
+
+/// Creates a persistent list containing the elements of a list.
+/// @param list The list whose elements should be contained in the created list, in the same order.
+/// @returns A reference to the created list.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCPersistentListRef HCPersistentListCreateWithList(HCListRef list);
+
+/// Creates a persistent list with an element appended to the elements of a persistent list.
+/// @param self A reference to the list to derive the created list from. It is not modified.
+/// @param object The object to append as an element to the created list. It is retained by the created list.
+/// @returns A reference to the created list.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCPersistentListRef HCPersistentListCreateByAddingObject(HCPersistentListRef self, HCRef object);
+
+/// Creates a persistent list with the elements of a persistent list except its last element.
+/// @param self A reference to the list to derive the created list from. It is not modified.
+/// @returns A reference to the created list. If @c self is empty, the created list is also empty.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCPersistentListRef HCPersistentListCreateByRemovingObject(HCPersistentListRef self);
+
+/// Creates a persistent list with the element at an index of a persistent list replaced by another object.
+/// @param self A reference to the list to derive the created list from. It is not modified.
+/// @param index The index of the element to replace. If the list does not contain @c index, the created list has the same elements as @c self.
+/// @param object The object to place at @c index in the created list. It is retained by the created list.
+/// @returns A reference to the created list.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCPersistentListRef HCPersistentListCreateByReplacingObjectAtIndex(HCPersistentListRef self, HCInteger index, HCRef object);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Polymorphic Functions
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Determines if the contents of a persistent list are equal to those of another persistent list.
+/// @param self A reference to the list to examine.
+/// @param other The other list to evaluate equality against.
+/// @returns @c true if @c self and @c other have the same element count and @c HCIsEqual() returns @c true for all elements in @c self when evaluated against the correspondingly indexed element of @c other. Returns @c false otherwise.
+HCBoolean HCPersistentListIsEqual(HCPersistentListRef self, HCPersistentListRef other);
+
+/// Calculates a hash value for the elements of a persistent list.
+/// @param self A reference to the list.
+/// @returns A hash value determined from each list element using @c HCHashValue(). Equal to the hash value of an @c HCList with the same elements.
+HCInteger HCPersistentListHashValue(HCPersistentListRef self);
+
+/// Prints a persistent list to a stream.
+/// @param self A reference to the list.
+/// @param stream The stream to which the list and its elements should be printed. Uses @c HCPrint() to print each element in the list.
+void HCPersistentListPrint(HCPersistentListRef self, FILE* stream);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Content
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Determines if a persistent list contains no elements.
+/// @param self A reference to the list.
+/// @returns @c true if the list contains no elements.
+HCBoolean HCPersistentListIsEmpty(HCPersistentListRef self);
+
+/// Determines the number of elements contained in a persistent list.
+/// @param self A reference to the list.
+/// @returns The list element count.
+HCInteger HCPersistentListCount(HCPersistentListRef self);
+
+/// Determines if an index indexes an element in a persistent list.
+/// @param self A reference to the list.
+/// @param index The index the list should be inspected for.
+/// @returns @c true if @c index is in the range @code [0, HCPersistentListCount()) @endcode. Otherwise returns @c false.
+HCBoolean HCPersistentListContainsIndex(HCPersistentListRef self, HCInteger index);
+
+/// Obtains the first object in a persistent list.
+/// @param self A reference to the list.
+/// @returns The element found at the first index in the list. If the list is empty, returns @c NULL.
+HCRef HCPersistentListFirstObject(HCPersistentListRef self);
+
+/// Obtains the last object in a persistent list.
+/// @param self A reference to the list.
+/// @returns The element found at the last index in the list. If the list is empty, returns @c NULL.
+HCRef HCPersistentListLastObject(HCPersistentListRef self);
+
+/// Obtains an object in a persistent list in O(log n) time.
+/// @param self A reference to the list.
+/// @param index The index of the desired list element. Should be in the range @code [0, HCPersistentListCount()) @endcode.
+/// @returns The element found at the index in the list. If the list does not contain @c index, returns @c NULL.
+HCRef HCPersistentListObjectAtIndex(HCPersistentListRef self, HCInteger index);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Conversion
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Creates a list containing the elements of a persistent list.
+/// @param self A reference to the persistent list.
+/// @returns A reference to the created list, which contains the elements of @c self in the same order and may be modified.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCListRef HCPersistentListCreateList(HCPersistentListRef self);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Iteration
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Iterates over the elements of a persistent list in order, calling a function on each.
+/// @param self A reference to the list.
+/// @param forEachFunction The function to be called on each element.
+/// @param context A value passed unmodified to @c forEachFunction.
+void HCPersistentListForEach(HCPersistentListRef self, HCPersistentListForEachFunction forEachFunction, void* context);
+
+#endif /* HCPersistentList_h */
@@ -0,0 +1,60 @@
+///
+/// @file HCPersistentList_Internal.h
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#ifndef HCPersistentList_Internal_h
+#define HCPersistentList_Internal_h
+
+#include "../Core/HCObject_Internal.h"
+#include "HCPersistentList.h"
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Definitions
+//----------------------------------------------------------------------------------------------------------------------------------
+#define HCPersistentListBranchBitsStatic (5)
+#define HCPersistentListBranchCountStatic (1 << HCPersistentListBranchBitsStatic)
+#define HCPersistentListBranchMaskStatic (HCPersistentListBranchCountStatic - 1)
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Type
+//----------------------------------------------------------------------------------------------------------------------------------
+// NOTE: Elements are stored in a radix-balanced trie of nodes with HCPersistentListBranchCountStatic children, where the children of
+//       leaf nodes are the elements and the children of branch nodes are nodes. The last leaf is kept outside the trie as the tail, so
+//       adding and removing at the end usually copies only the tail. Nodes are objects, so lists derived from each other share the
+//       nodes they have in common by retaining them, and a node is destroyed when the last list or node containing it is.
+extern HCType HCPersistentListNodeType;
+
+typedef struct HCPersistentListNode {
+    HCObject base;
+    HCRef children[HCPersistentListBranchCountStatic];
+} HCPersistentListNode;
+
+typedef struct HCPersistentListNode* HCPersistentListNodeRef;
+
+typedef struct HCPersistentList {
+    HCObject base;
+    HCInteger count;
+    HCInteger shift;
+    HCPersistentListNodeRef root;
+    HCPersistentListNodeRef tail;
+} HCPersistentList;
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Construction
+//----------------------------------------------------------------------------------------------------------------------------------
+void HCPersistentListInit(void* memory, HCInteger count, HCInteger shift, HCPersistentListNodeRef root, HCPersistentListNodeRef tail);
+void HCPersistentListDestroy(HCPersistentListRef self);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Nodes
+//----------------------------------------------------------------------------------------------------------------------------------
+HCPersistentListNodeRef HCPersistentListNodeCreateCopy(HCPersistentListNodeRef node);
+void HCPersistentListNodeInit(void* memory, HCPersistentListNodeRef node);
+void HCPersistentListNodeDestroy(HCPersistentListNodeRef self);
+
+#endif /* HCPersistentList_Internal_h */
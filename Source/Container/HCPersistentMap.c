@@ -0,0 +1,452 @@
+///
+/// @file HCPersistentMap.c
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#include "HCPersistentMap_Internal.h"
+#include <string.h>
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Type
+//----------------------------------------------------------------------------------------------------------------------------------
+const HCObjectTypeData HCPersistentMapTypeDataInstance = {
+    .base = {
+        .ancestor = &HCObjectTypeDataInstance.base,
+        .name = "HCPersistentMap",
+        .identifier = HCTypeIdentifierPersistentMap,
+        .kindMask = HCTypeKindMaskForIdentifier(HCTypeIdentifierObject) | HCTypeKindMaskForIdentifier(HCTypeIdentifierPersistentMap),
+    },
+    .isEqual = (void*)HCPersistentMapIsEqual,
+    .hashValue = (void*)HCPersistentMapHashValue,
+    .print = (void*)HCPersistentMapPrint,
+    .destroy = (void*)HCPersistentMapDestroy,
+};
+HCType HCPersistentMapType = (HCType)&HCPersistentMapTypeDataInstance;
+
+const HCObjectTypeData HCPersistentMapNodeTypeDataInstance = {
+    .base = {
+        .ancestor = &HCObjectTypeDataInstance.base,
+        .name = "HCPersistentMapNode",
+        .identifier = HCTypeIdentifierPersistentMapNode,
+        .kindMask = HCTypeKindMaskForIdentifier(HCTypeIdentifierObject) | HCTypeKindMaskForIdentifier(HCTypeIdentifierPersistentMapNode),
+    },
+    .isEqual = (void*)HCObjectIsEqual,
+    .hashValue = (void*)HCObjectHashValue,
+    .print = (void*)HCObjectPrint,
+    .destroy = (void*)HCPersistentMapNodeDestroy,
+};
+HCType HCPersistentMapNodeType = (HCType)&HCPersistentMapNodeTypeDataInstance;
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Nodes
+//----------------------------------------------------------------------------------------------------------------------------------
+HCPersistentMapNodeRef HCPersistentMapNodeCreate(uint32_t entryMap, uint32_t nodeMap, HCInteger collisionCount, HCRef* slots) {
+    HCInteger slotCount = 2 * (collisionCount + __builtin_popcount(entryMap)) + __builtin_popcount(nodeMap);
+    HCPersistentMapNodeRef self = HCObjectAllocate(sizeof(HCPersistentMapNode) + slotCount * sizeof(HCRef));
+    HCPersistentMapNodeInit(self, entryMap, nodeMap, collisionCount, slots);
+    return self;
+}
+
+void HCPersistentMapNodeInit(void* memory, uint32_t entryMap, uint32_t nodeMap, HCInteger collisionCount, HCRef* slots) {
+    HCObjectInit(memory);
+    HCPersistentMapNodeRef self = memory;
+    self->base.type = HCPersistentMapNodeType;
+    self->entryMap = entryMap;
+    self->nodeMap = nodeMap;
+    self->collisionCount = collisionCount;
+    HCInteger slotCount = HCPersistentMapNodeSlotCount(self);
+    if (slotCount > 0) {
+        memcpy(self->slots, slots, slotCount * sizeof(HCRef));
+        HCRetainArray(self->slots, slotCount);
+    }
+}
+
+void HCPersistentMapNodeDestroy(HCPersistentMapNodeRef self) {
+    HCReleaseArray(self->slots, HCPersistentMapNodeSlotCount(self));
+}
+
+HCInteger HCPersistentMapNodeEntryCount(HCPersistentMapNodeRef self) {
+    return self->collisionCount + __builtin_popcount(self->entryMap);
+}
+
+HCInteger HCPersistentMapNodeSlotCount(HCPersistentMapNodeRef self) {
+    return 2 * HCPersistentMapNodeEntryCount(self) + __builtin_popcount(self->nodeMap);
+}
+
+/// Determines the fragment of a key hash consumed by a node.
+static uint32_t HCPersistentMapNodeBit(HCInteger hash, HCInteger shift) {
+    return (uint32_t)1 << (((uint64_t)hash >> shift) & HCPersistentMapBranchMaskStatic);
+}
+
+/// Creates a copy of a node with a range of its slots replaced by other slots.
+/// @param self The node to copy.
+/// @param entryMap The entry map of the created node.
+/// @param nodeMap The node map of the created node.
+/// @param collisionCount The collision count of the created node.
+/// @param removeIndex The index of the first slot of @c self to leave out of the created node.
+/// @param removeCount The number of slots of @c self to leave out of the created node.
+/// @param insertIndex The index in the created node of the first inserted slot, counted after the removed slots are left out.
+/// @param inserted The slots to insert, which are retained by the created node.
+/// @param insertCount The number of slots to insert.
+/// @returns The created node.
+static HCPersistentMapNodeRef HCPersistentMapNodeCreateBySplicing(HCPersistentMapNodeRef self, uint32_t entryMap, uint32_t nodeMap, HCInteger collisionCount, HCInteger removeIndex, HCInteger removeCount, HCInteger insertIndex, HCRef* inserted, HCInteger insertCount) {
+    // Gather the kept slots with the inserted slots, on the stack unless the node is a large collision node
+    HCInteger slotCount = HCPersistentMapNodeSlotCount(self);
+    HCInteger splicedCount = slotCount - removeCount + insertCount;
+    HCRef stackSlots[HCPersistentMapNodeMaximumSlotCountStatic];
+    HCRef* slots = splicedCount <= HCPersistentMapNodeMaximumSlotCountStatic ? stackSlots : malloc(splicedCount * sizeof(HCRef));
+    // TODO: Failable
+    memcpy(slots, self->slots, removeIndex * sizeof(HCRef));
+    memcpy(slots + removeIndex, self->slots + removeIndex + removeCount, (slotCount - removeIndex - removeCount) * sizeof(HCRef));
+    memmove(slots + insertIndex + insertCount, slots + insertIndex, (slotCount - removeCount - insertIndex) * sizeof(HCRef));
+    if (insertCount > 0) {
+        memcpy(slots + insertIndex, inserted, insertCount * sizeof(HCRef));
+    }
+    HCPersistentMapNodeRef node = HCPersistentMapNodeCreate(entryMap, nodeMap, collisionCount, slots);
+    if (slots != stackSlots) {
+        free(slots);
+    }
+    return node;
+}
+
+/// Creates a node holding two pairs whose keys are not equal.
+/// @param shift The number of hash bits consumed above the created node.
+/// @returns The created node, which stores the pairs, a child holding them, or a collision node if their hashes are equal.
+static HCPersistentMapNodeRef HCPersistentMapNodeCreateWithPairs(HCRef key, HCRef object, HCInteger hash, HCRef otherKey, HCRef otherObject, HCInteger otherHash, HCInteger shift) {
+    if (shift >= HCPersistentMapHashBitsStatic) {
+        HCRef slots[] = { key, object, otherKey, otherObject };
+        return HCPersistentMapNodeCreate(0, 0, 2, slots);
+    }
+    uint32_t bit = HCPersistentMapNodeBit(hash, shift);
+    uint32_t otherBit = HCPersistentMapNodeBit(otherHash, shift);
+    if (bit != otherBit) {
+        HCRef slots[] = { key, object, otherKey, otherObject };
+        HCRef swappedSlots[] = { otherKey, otherObject, key, object };
+        return HCPersistentMapNodeCreate(bit | otherBit, 0, 0, bit < otherBit ? slots : swappedSlots);
+    }
+    HCRef child = HCPersistentMapNodeCreateWithPairs(key, object, hash, otherKey, otherObject, otherHash, shift + HCPersistentMapBranchBitsStatic);
+    HCPersistentMapNodeRef node = HCPersistentMapNodeCreate(0, bit, 0, &child);
+    HCRelease(child);
+    return node;
+}
+
+/// Finds the slot of a key in a trie.
+/// @returns The slot holding the key, followed by the slot holding its object, or @c NULL if the trie does not contain the key.
+static HCRef* HCPersistentMapNodeFindKey(HCPersistentMapNodeRef self, HCRef key, HCInteger hash) {
+    for (HCInteger shift = 0; ; shift += HCPersistentMapBranchBitsStatic) {
+        if (self->collisionCount > 0) {
+            for (HCInteger entryIndex = 0; entryIndex < self->collisionCount; entryIndex++) {
+                if (HCIsEqual(self->slots[entryIndex * 2], key)) {
+                    return &self->slots[entryIndex * 2];
+                }
+            }
+            return NULL;
+        }
+        uint32_t bit = HCPersistentMapNodeBit(hash, shift);
+        if (self->entryMap & bit) {
+            HCInteger entryIndex = __builtin_popcount(self->entryMap & (bit - 1));
+            return HCIsEqual(self->slots[entryIndex * 2], key) ? &self->slots[entryIndex * 2] : NULL;
+        }
+        if (!(self->nodeMap & bit)) {
+            return NULL;
+        }
+        HCInteger childIndex = 2 * HCPersistentMapNodeEntryCount(self) + __builtin_popcount(self->nodeMap & (bit - 1));
+        self = self->slots[childIndex];
+    }
+}
+
+/// Creates a copy of a trie with an object associated with a key, copying only the nodes on the path to the key.
+/// @param self The root of the trie to copy.
+/// @param key The key to associate @c object with.
+/// @param object The object to associate with @c key.
+/// @param hash The hash value of @c key.
+/// @param shift The number of hash bits consumed above @c self.
+/// @param added Set to @c true if the key was not already in the trie.
+/// @returns The root of the created trie.
+static HCPersistentMapNodeRef HCPersistentMapNodeCreateByAddingObjectForKey(HCPersistentMapNodeRef self, HCRef key, HCRef object, HCInteger hash, HCInteger shift, HCBoolean* added) {
+    // Replace or append the pair in a collision node
+    HCInteger entryCount = HCPersistentMapNodeEntryCount(self);
+    if (self->collisionCount > 0) {
+        HCRef pair[] = { key, object };
+        for (HCInteger entryIndex = 0; entryIndex < self->collisionCount; entryIndex++) {
+            if (HCIsEqual(self->slots[entryIndex * 2], key)) {
+                return HCPersistentMapNodeCreateBySplicing(self, 0, 0, self->collisionCount, entryIndex * 2 + 1, 1, entryIndex * 2 + 1, &object, 1);
+            }
+        }
+        *added = true;
+        return HCPersistentMapNodeCreateBySplicing(self, 0, 0, self->collisionCount + 1, 0, 0, entryCount * 2, pair, 2);
+    }
+
+    // Replace the object of an equal key, or move a pair with another key into a child along with the added pair
+    uint32_t bit = HCPersistentMapNodeBit(hash, shift);
+    HCInteger entryIndex = __builtin_popcount(self->entryMap & (bit - 1));
+    HCInteger childIndex = __builtin_popcount(self->nodeMap & (bit - 1));
+    if (self->entryMap & bit) {
+        HCRef existingKey = self->slots[entryIndex * 2];
+        if (HCIsEqual(existingKey, key)) {
+            return HCPersistentMapNodeCreateBySplicing(self, self->entryMap, self->nodeMap, 0, entryIndex * 2 + 1, 1, entryIndex * 2 + 1, &object, 1);
+        }
+        *added = true;
+        HCRef existingObject = self->slots[entryIndex * 2 + 1];
+        HCRef child = HCPersistentMapNodeCreateWithPairs(existingKey, existingObject, HCHashValue(existingKey), key, object, hash, shift + HCPersistentMapBranchBitsStatic);
+        HCPersistentMapNodeRef node = HCPersistentMapNodeCreateBySplicing(self, self->entryMap ^ bit, self->nodeMap | bit, 0, entryIndex * 2, 2, (entryCount - 1) * 2 + childIndex, &child, 1);
+        HCRelease(child);
+        return node;
+    }
+
+    // Add the pair to the child for the key
+    if (self->nodeMap & bit) {
+        HCInteger slotIndex = entryCount * 2 + childIndex;
+        HCRef child = HCPersistentMapNodeCreateByAddingObjectForKey(self->slots[slotIndex], key, object, hash, shift + HCPersistentMapBranchBitsStatic, added);
+        HCPersistentMapNodeRef node = HCPersistentMapNodeCreateBySplicing(self, self->entryMap, self->nodeMap, 0, slotIndex, 1, slotIndex, &child, 1);
+        HCRelease(child);
+        return node;
+    }
+
+    // Add the pair to the node
+    *added = true;
+    HCRef pair[] = { key, object };
+    return HCPersistentMapNodeCreateBySplicing(self, self->entryMap | bit, self->nodeMap, 0, 0, 0, entryIndex * 2, pair, 2);
+}
+
+/// Creates a copy of a trie without the pair of a key, copying only the nodes on the path to the key.
+/// @param self The root of the trie to copy.
+/// @param key The key of the pair to leave out.
+/// @param hash The hash value of @c key.
+/// @param shift The number of hash bits consumed above @c self.
+/// @param removed Set to @c true if the key was in the trie.
+/// @returns The root of the created trie, or @c self retained if the trie does not contain the key.
+static HCPersistentMapNodeRef HCPersistentMapNodeCreateByRemovingObjectForKey(HCPersistentMapNodeRef self, HCRef key, HCInteger hash, HCInteger shift, HCBoolean* removed) {
+    // Remove the pair from a collision node
+    HCInteger entryCount = HCPersistentMapNodeEntryCount(self);
+    if (self->collisionCount > 0) {
+        for (HCInteger entryIndex = 0; entryIndex < self->collisionCount; entryIndex++) {
+            if (HCIsEqual(self->slots[entryIndex * 2], key)) {
+                *removed = true;
+                return HCPersistentMapNodeCreateBySplicing(self, 0, 0, self->collisionCount - 1, entryIndex * 2, 2, entryIndex * 2, NULL, 0);
+            }
+        }
+        return HCRetain(self);
+    }
+
+    // Remove the pair from the node
+    uint32_t bit = HCPersistentMapNodeBit(hash, shift);
+    HCInteger entryIndex = __builtin_popcount(self->entryMap & (bit - 1));
+    HCInteger childIndex = __builtin_popcount(self->nodeMap & (bit - 1));
+    if (self->entryMap & bit) {
+        if (!HCIsEqual(self->slots[entryIndex * 2], key)) {
+            return HCRetain(self);
+        }
+        *removed = true;
+        return HCPersistentMapNodeCreateBySplicing(self, self->entryMap ^ bit, self->nodeMap, 0, entryIndex * 2, 2, entryIndex * 2, NULL, 0);
+    }
+    if (!(self->nodeMap & bit)) {
+        return HCRetain(self);
+    }
+
+    // Remove the pair from the child for the key, moving the child's remaining pair into the node if it has only one
+    HCInteger slotIndex = entryCount * 2 + childIndex;
+    HCPersistentMapNodeRef child = HCPersistentMapNodeCreateByRemovingObjectForKey(self->slots[slotIndex], key, hash, shift + HCPersistentMapBranchBitsStatic, removed);
+    HCPersistentMapNodeRef node = NULL;
+    if (!*removed) {
+        node = HCRetain(self);
+    }
+    else if (HCPersistentMapNodeEntryCount(child) == 1 && child->nodeMap == 0) {
+        node = HCPersistentMapNodeCreateBySplicing(self, self->entryMap | bit, self->nodeMap ^ bit, 0, slotIndex, 1, entryIndex * 2, child->slots, 2);
+    }
+    else {
+        HCRef replacement = child;
+        node = HCPersistentMapNodeCreateBySplicing(self, self->entryMap, self->nodeMap, 0, slotIndex, 1, slotIndex, &replacement, 1);
+    }
+    HCRelease(child);
+    return node;
+}
+
+/// Calls a function on each pair in a trie.
+static void HCPersistentMapNodeForEach(HCPersistentMapNodeRef self, HCPersistentMapRef map, HCPersistentMapForEachFunction forEachFunction, void* context) {
+    HCInteger entryCount = HCPersistentMapNodeEntryCount(self);
+    for (HCInteger entryIndex = 0; entryIndex < entryCount; entryIndex++) {
+        forEachFunction(context, map, self->slots[entryIndex * 2], self->slots[entryIndex * 2 + 1]);
+    }
+    HCInteger slotCount = HCPersistentMapNodeSlotCount(self);
+    for (HCInteger slotIndex = entryCount * 2; slotIndex < slotCount; slotIndex++) {
+        HCPersistentMapNodeForEach(self->slots[slotIndex], map, forEachFunction, context);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Construction
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Creates a map from its storage.
+/// @param count The number of pairs in the map.
+/// @param root The root of the trie, which is owned by the created map.
+/// @returns A reference to the created map.
+static HCPersistentMapRef HCPersistentMapCreateWithStorage(HCInteger count, HCPersistentMapNodeRef root) {
+    HCPersistentMapRef self = HCObjectAllocate(sizeof(HCPersistentMap));
+    HCPersistentMapInit(self, count, root);
+    return self;
+}
+
+HCPersistentMapRef HCPersistentMapCreate(void) {
+    return HCPersistentMapCreateWithStorage(0, HCPersistentMapNodeCreate(0, 0, 0, NULL));
+}
+
+HCPersistentMapRef HCPersistentMapCreateWithMap(HCMapRef map) {
+    HCPersistentMapRef self = HCPersistentMapCreate();
+    for (HCMapIterator i = HCMapIterationBegin(map); !HCMapIterationHasEnded(&i); HCMapIterationNext(&i)) {
+        HCPersistentMapRef added = HCPersistentMapCreateByAddingObjectForKey(self, i.key, i.object);
+        HCRelease(self);
+        self = added;
+    }
+    return self;
+}
+
+HCPersistentMapRef HCPersistentMapCreateByAddingObjectForKey(HCPersistentMapRef self, HCRef key, HCRef object) {
+    HCBoolean added = false;
+    HCPersistentMapNodeRef root = HCPersistentMapNodeCreateByAddingObjectForKey(self->root, key, object, HCHashValue(key), 0, &added);
+    return HCPersistentMapCreateWithStorage(added ? self->count + 1 : self->count, root);
+}
+
+HCPersistentMapRef HCPersistentMapCreateByRemovingObjectForKey(HCPersistentMapRef self, HCRef key) {
+    // NOTE: Since persistent maps are immutable, an unchanged map can be shared rather than copied
+    HCBoolean removed = false;
+    HCPersistentMapNodeRef root = HCPersistentMapNodeCreateByRemovingObjectForKey(self->root, key, HCHashValue(key), 0, &removed);
+    if (!removed) {
+        HCRelease(root);
+        return HCRetain(self);
+    }
+    return HCPersistentMapCreateWithStorage(self->count - 1, root);
+}
+
+void HCPersistentMapInit(void* memory, HCInteger count, HCPersistentMapNodeRef root) {
+    HCObjectInit(memory);
+    HCPersistentMapRef self = memory;
+    self->base.type = HCPersistentMapType;
+    self->count = count;
+    self->root = root;
+}
+
+void HCPersistentMapDestroy(HCPersistentMapRef self) {
+    HCRelease(self->root);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Polymorphic Functions
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Context of a for-each iteration comparing the pairs of a map to another map.
+typedef struct HCPersistentMapIsEqualContext {
+    HCPersistentMapRef other;
+    HCBoolean isEqual;
+} HCPersistentMapIsEqualContext;
+
+/// Checks that a pair of a map is in the other map of the comparison.
+static void HCPersistentMapIsEqualPair(void* context, HCPersistentMapRef map, HCRef key, HCRef object) {
+    (void)map; // unused
+    HCPersistentMapIsEqualContext* comparison = context;
+    if (!comparison->isEqual) {
+        return;
+    }
+    HCRef* slot = HCPersistentMapNodeFindKey(comparison->other->root, key, HCHashValue(key));
+    comparison->isEqual = slot != NULL && HCIsEqual(object, slot[1]);
+}
+
+HCBoolean HCPersistentMapIsEqual(HCPersistentMapRef self, HCPersistentMapRef other) {
+    if (self->count != other->count) {
+        return false;
+    }
+    if (self->root == other->root) {
+        return true;
+    }
+    HCPersistentMapIsEqualContext comparison = { .other = other, .isEqual = true };
+    HCPersistentMapForEach(self, HCPersistentMapIsEqualPair, &comparison);
+    return comparison.isEqual;
+}
+
+/// Adds the hash of the key of a pair to an unsigned hash value, which wraps on overflow.
+static void HCPersistentMapHashValuePair(void* context, HCPersistentMapRef map, HCRef key, HCRef object) {
+    (void)map; // unused
+    (void)object; // unused
+    *(uint64_t*)context += (uint64_t)HCHashValue(key);
+}
+
+HCInteger HCPersistentMapHashValue(HCPersistentMapRef self) {
+    // NOTE: Key hashes are summed so that equal maps hash equally regardless of the structure of their tries
+    uint64_t hash = 5381;
+    HCPersistentMapForEach(self, HCPersistentMapHashValuePair, &hash);
+    return (HCInteger)hash;
+}
+
+/// Context of a for-each iteration printing the pairs of a map.
+typedef struct HCPersistentMapPrintContext {
+    FILE* stream;
+    HCBoolean isFirst;
+} HCPersistentMapPrintContext;
+
+/// Prints a pair of a map, separated from the preceding pair.
+static void HCPersistentMapPrintPair(void* context, HCPersistentMapRef map, HCRef key, HCRef object) {
+    (void)map; // unused
+    HCPersistentMapPrintContext* printing = context;
+    if (!printing->isFirst) {
+        fprintf(printing->stream, ",");
+    }
+    printing->isFirst = false;
+    HCPrint(key, printing->stream);
+    fprintf(printing->stream, ",");
+    HCPrint(object, printing->stream);
+}
+
+void HCPersistentMapPrint(HCPersistentMapRef self, FILE* stream) {
+    fprintf(stream, "{");
+    HCPersistentMapPrintContext printing = { .stream = stream, .isFirst = true };
+    HCPersistentMapForEach(self, HCPersistentMapPrintPair, &printing);
+    fprintf(stream, "}");
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Content
+//----------------------------------------------------------------------------------------------------------------------------------
+HCBoolean HCPersistentMapIsEmpty(HCPersistentMapRef self) {
+    return HCPersistentMapCount(self) == 0;
+}
+
+HCInteger HCPersistentMapCount(HCPersistentMapRef self) {
+    return self->count;
+}
+
+HCBoolean HCPersistentMapContainsKey(HCPersistentMapRef self, HCRef key) {
+    return HCPersistentMapNodeFindKey(self->root, key, HCHashValue(key)) != NULL;
+}
+
+HCRef HCPersistentMapObjectForKey(HCPersistentMapRef self, HCRef key) {
+    HCRef* slot = HCPersistentMapNodeFindKey(self->root, key, HCHashValue(key));
+    return slot == NULL ? NULL : slot[1];
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Conversion
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Adds a pair of a persistent map to a map.
+static void HCPersistentMapCreateMapPair(void* context, HCPersistentMapRef map, HCRef key, HCRef object) {
+    (void)map; // unused
+    HCMapAddObjectForKey(context, key, object);
+}
+
+HCMapRef HCPersistentMapCreateMap(HCPersistentMapRef self) {
+    HCMapRef map = HCMapCreateWithCapacity(self->count > 0 ? self->count : 1);
+    HCPersistentMapForEach(self, HCPersistentMapCreateMapPair, map);
+    return map;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Iteration
+//----------------------------------------------------------------------------------------------------------------------------------
+void HCPersistentMapForEach(HCPersistentMapRef self, HCPersistentMapForEachFunction forEachFunction, void* context) {
+    HCPersistentMapNodeForEach(self->root, self, forEachFunction, context);
+}
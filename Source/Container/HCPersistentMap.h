@@ -0,0 +1,138 @@
+///
+/// @file HCPersistentMap.h
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+/// @brief Immutable key-value store that shares storage with the maps it is derived from.
+///
+
+#ifndef HCPersistentMap_h
+#define HCPersistentMap_h
+
+#include "../Core/HCObject.h"
+#include "HCMap.h"
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Type
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Type of @c HCPersistentMap instances.
+extern HCType HCPersistentMapType;
+
+/// A reference to an @c HCPersistentMap instance.
+typedef struct HCPersistentMap* HCPersistentMapRef;
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Other Definitions
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Function operating on a key-value pair of a persistent map during a for-each iteration over the map.
+/// @param context The unmodified context value provided to @c HCPersistentMapForEach().
+/// @param map The subject map of the iteration.
+/// @param key The key of the current pair.
+/// @param object The object associated with @c key.
+typedef void (*HCPersistentMapForEachFunction)(void* context, HCPersistentMapRef map, HCRef key, HCRef object);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Construction
+//----------------------------------------------------------------------------------------------------------------------------------
+// NOTE: Persistent maps are never modified after creation. Maps created from another persistent map share all storage not affected
+//       by the change with it, so creating a changed map takes O(log n) time and memory, and the original map remains valid and
+//       unchanged. Since they are immutable, persistent maps may be read from multiple threads without locking.
+
+/// Creates an empty persistent map.
+/// @returns A reference to the created map.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCPersistentMapRef HCPersistentMapCreate(void);
+
+/// Creates a persistent map containing the key-value pairs of a map.
+/// @param map The map whose key-value pairs should be contained in the created map.
+/// @returns A reference to the created map.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCPersistentMapRef HCPersistentMapCreateWithMap(HCMapRef map);
+
+/// Creates a persistent map with the key-value pairs of a persistent map and an object associated with a key.
+/// @param self A reference to the map to derive the created map from. It is not modified.
+/// @param key The key to associate @c object with. If @c self contains an equal key, the created map associates @c object with the existing key instead of the pair's object.
+/// @param object The object to associate with @c key. It is retained by the created map, as is @c key.
+/// @returns A reference to the created map.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCPersistentMapRef HCPersistentMapCreateByAddingObjectForKey(HCPersistentMapRef self, HCRef key, HCRef object);
+
+/// Creates a persistent map with the key-value pairs of a persistent map except the pair with a key.
+/// @param self A reference to the map to derive the created map from. It is not modified.
+/// @param key The key of the pair to leave out. If @c self does not contain an equal key, the created map has the same pairs as @c self.
+/// @returns A reference to the created map.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCPersistentMapRef HCPersistentMapCreateByRemovingObjectForKey(HCPersistentMapRef self, HCRef key);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Polymorphic Functions
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Determines if the contents of a persistent map are equal to those of another persistent map.
+/// @param self A reference to the map to examine.
+/// @param other The other map to evaluate equality against.
+/// @returns @c true if @c self and @c other have the same number of pairs and each key of @c self is associated with an equal object in @c other. Returns @c false otherwise.
+HCBoolean HCPersistentMapIsEqual(HCPersistentMapRef self, HCPersistentMapRef other);
+
+/// Calculates a hash value for the keys of a persistent map.
+/// @param self A reference to the map.
+/// @returns A hash value determined from each key using @c HCHashValue(), regardless of the order of the keys.
+HCInteger HCPersistentMapHashValue(HCPersistentMapRef self);
+
+/// Prints a persistent map to a stream.
+/// @param self A reference to the map.
+/// @param stream The stream to which the map and its pairs should be printed. Uses @c HCPrint() to print each key and object in the map.
+void HCPersistentMapPrint(HCPersistentMapRef self, FILE* stream);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Content
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Determines if a persistent map contains no key-value pairs.
+/// @param self A reference to the map.
+/// @returns @c true if the map contains no key-value pairs.
+HCBoolean HCPersistentMapIsEmpty(HCPersistentMapRef self);
+
+/// Determines the number of key-value pairs contained in a persistent map.
+/// @param self A reference to the map.
+/// @returns The number of key-value pairs.
+HCInteger HCPersistentMapCount(HCPersistentMapRef self);
+
+/// Determines if a persistent map contains a key in O(log n) time.
+/// @param self A reference to the map.
+/// @param key The key to search for. Uses @c HCHashValue() and @c HCIsEqual() to find the key.
+/// @returns @c true if the map contains a key equal to @c key, or @c false otherwise.
+HCBoolean HCPersistentMapContainsKey(HCPersistentMapRef self, HCRef key);
+
+/// Obtains the object associated with a key in a persistent map in O(log n) time.
+/// @param self A reference to the map.
+/// @param key The key to search for. Uses @c HCHashValue() and @c HCIsEqual() to find the key.
+/// @returns The object associated with @c key, or @c NULL if the map does not contain @c key.
+HCRef HCPersistentMapObjectForKey(HCPersistentMapRef self, HCRef key);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Conversion
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Creates a map containing the key-value pairs of a persistent map.
+/// @param self A reference to the persistent map.
+/// @returns A reference to the created map, which contains the key-value pairs of @c self and may be modified.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCMapRef HCPersistentMapCreateMap(HCPersistentMapRef self);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Iteration
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Iterates over the key-value pairs of a persistent map in no particular order, calling a function on each.
+/// @param self A reference to the map.
+/// @param forEachFunction The function to be called on each key-value pair.
+/// @param context A value passed unmodified to @c forEachFunction.
+void HCPersistentMapForEach(HCPersistentMapRef self, HCPersistentMapForEachFunction forEachFunction, void* context);
+
+#endif /* HCPersistentMap_h */
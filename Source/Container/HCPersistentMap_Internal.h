@@ -0,0 +1,67 @@
+///
+/// @file HCPersistentMap_Internal.h
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#ifndef HCPersistentMap_Internal_h
+#define HCPersistentMap_Internal_h
+
+#include "../Core/HCObject_Internal.h"
+#include "HCPersistentMap.h"
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Definitions
+//----------------------------------------------------------------------------------------------------------------------------------
+#define HCPersistentMapBranchBitsStatic (5)
+#define HCPersistentMapBranchMaskStatic ((1 << HCPersistentMapBranchBitsStatic) - 1)
+#define HCPersistentMapHashBitsStatic (64)
+#define HCPersistentMapNodeMaximumSlotCountStatic (2 << HCPersistentMapBranchBitsStatic)
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Type
+//----------------------------------------------------------------------------------------------------------------------------------
+// NOTE: Pairs are stored in a hash array mapped trie, where each node consumes HCPersistentMapBranchBitsStatic bits of key hashes.
+//       A node's entryMap has a bit set for each hash fragment with a pair stored in the node, and its nodeMap has a bit set for each
+//       fragment with a child node, so slots hold only the pairs and children present: the keys and objects of the pairs in fragment
+//       order, followed by the children in fragment order. A child always holds at least two pairs, since a single pair is stored in
+//       its parent instead. Once all hash bits are consumed, keys with equal hashes are stored unordered in a collision node, which
+//       has no map bits set and a nonzero collisionCount. Nodes are objects, so maps derived from each other share the nodes they
+//       have in common by retaining them.
+extern HCType HCPersistentMapNodeType;
+
+typedef struct HCPersistentMapNode {
+    HCObject base;
+    uint32_t entryMap;
+    uint32_t nodeMap;
+    HCInteger collisionCount;
+    HCRef slots[];
+} HCPersistentMapNode;
+
+typedef struct HCPersistentMapNode* HCPersistentMapNodeRef;
+
+typedef struct HCPersistentMap {
+    HCObject base;
+    HCInteger count;
+    HCPersistentMapNodeRef root;
+} HCPersistentMap;
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Construction
+//----------------------------------------------------------------------------------------------------------------------------------
+void HCPersistentMapInit(void* memory, HCInteger count, HCPersistentMapNodeRef root);
+void HCPersistentMapDestroy(HCPersistentMapRef self);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Nodes
+//----------------------------------------------------------------------------------------------------------------------------------
+HCPersistentMapNodeRef HCPersistentMapNodeCreate(uint32_t entryMap, uint32_t nodeMap, HCInteger collisionCount, HCRef* slots);
+void HCPersistentMapNodeInit(void* memory, uint32_t entryMap, uint32_t nodeMap, HCInteger collisionCount, HCRef* slots);
+void HCPersistentMapNodeDestroy(HCPersistentMapNodeRef self);
+HCInteger HCPersistentMapNodeEntryCount(HCPersistentMapNodeRef self);
+HCInteger HCPersistentMapNodeSlotCount(HCPersistentMapNodeRef self);
+
+#endif /* HCPersistentMap_Internal_h */
@@ -18,6 +18,8 @@ const HCObjectTypeData HCSetTypeDataInstance = {
     .base = {
         .ancestor = &HCObjectTypeDataInstance.base,
         .name = "HCSet",
+        .identifier = HCTypeIdentifierSet,
+        .kindMask = HCTypeKindMaskForIdentifier(HCTypeIdentifierObject) | HCTypeKindMaskForIdentifier(HCTypeIdentifierSet),
     },
     .isEqual = (void*)HCSetIsEqual,
     .hashValue = (void*)HCSetHashValue,
@@ -37,38 +39,202 @@ const HCSetIterator HCSetIteratorInvalid = { .set = NULL, .index = HCSetNotFound
 // MARK: - Construction
 //----------------------------------------------------------------------------------------------------------------------------------
 HCSetRef HCSetCreate() {
-    return HCSetCreateWithCapacity(8);
+    return HCSetCreateWithCapacity(HCSetMinimumCapacityStatic);
 }
 
 HCSetRef HCSetCreateWithCapacity(HCInteger capacity) {
-    HCSetRef self = calloc(sizeof(HCSet), 1);
+    HCSetRef self = HCObjectAllocate(sizeof(HCSet));
     HCSetInit(self, capacity);
     return self;
 }
 
 void HCSetInit(void* memory, HCInteger capacity) {
-    HCSetSlot* slots = calloc(sizeof(HCSetSlot), capacity);
+    // Allocate enough slots and entries to contain the requested capacity of objects without exceeding the load factor
+    // NOTE: Setting all bytes of a slot to 0xFF sets it to HCSetNotFound, marking it empty
+    HCInteger slotCount = HCSetSlotCountForCapacity(capacity);
+    HCInteger entryCapacity = HCSetEntryCapacityForSlotCount(slotCount);
+    HCInteger* slots = malloc(slotCount * sizeof(HCInteger));
+    memset(slots, 0xFF, slotCount * sizeof(HCInteger));
+    HCSetEntry* entries = malloc(entryCapacity * sizeof(HCSetEntry));
     // TODO: Check that the allocation proceeded successfully, determine how to pass the error otherwise
     
     HCObjectInit(memory);
     HCSetRef self = memory;
-    self->capacity = capacity;
     self->count = 0;
+    self->capacity = slotCount;
     self->slots = slots;
+    self->entryCount = 0;
+    self->entryCapacity = entryCapacity;
+    self->entries = entries;
+    self->liveCounts = NULL;
     self->base.type = HCSetType;
 }
 
 void HCSetDestroy(HCSetRef self) {
     HCSetClear(self);
+    free(self->slots);
+    free(self->entries);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Storage
+//----------------------------------------------------------------------------------------------------------------------------------
+HCInteger HCSetSlotCountForCapacity(HCInteger capacity) {
+    // Find the smallest power-of-two slot count that can hold the capacity without exceeding the load factor
+    HCInteger slotCount = HCSetMinimumCapacityStatic;
+    while (HCSetEntryCapacityForSlotCount(slotCount) < capacity) {
+        slotCount *= 2;
+    }
+    return slotCount;
+}
+
+HCInteger HCSetEntryCapacityForSlotCount(HCInteger slotCount) {
+    return slotCount * HCSetLoadFactorNumeratorStatic / HCSetLoadFactorDenominatorStatic;
+}
+
+HCInteger HCSetSlotIndexForHash(HCSetRef self, HCInteger hash) {
+    // Mix the hash so that hashes differing only in their high bits, such as those of integers with common low bits, spread over the slots
+    // NOTE: The slot count is always a power of two, so masking is equivalent to an unsigned modulo
+    uint64_t mixed = (uint64_t)hash * 0x9E3779B97F4A7C15ull;
+    return (HCInteger)((mixed ^ (mixed >> 32)) & (uint64_t)(self->capacity - 1));
+}
+
+void HCSetResize(HCSetRef self, HCInteger slotCount) {
+    // Remove holes left by removed objects so the entries fit in their new capacity
+    HCSetCompact(self);
+    
+    // Resize the entries array and replace the slot array
+    HCInteger entryCapacity = HCSetEntryCapacityForSlotCount(slotCount);
+    self->entries = realloc(self->entries, entryCapacity * sizeof(HCSetEntry));
+    self->entryCapacity = entryCapacity;
+    free(self->slots);
+    self->slots = malloc(slotCount * sizeof(HCInteger));
+    self->capacity = slotCount;
+    // TODO: Check that the allocation proceeded successfully, determine how to pass the error otherwise
+    
+    // Index each entry in the new slot array using its cached hash, which avoids both hashing and equality checks
+    memset(self->slots, 0xFF, slotCount * sizeof(HCInteger));
+    HCInteger mask = slotCount - 1;
+    for (HCInteger entryIndex = 0; entryIndex < self->entryCount; entryIndex++) {
+        HCInteger slotIndex = HCSetSlotIndexForHash(self, self->entries[entryIndex].hash);
+        while (self->slots[slotIndex] != HCSetNotFound) {
+            slotIndex = (slotIndex + 1) & mask;
+        }
+        self->slots[slotIndex] = entryIndex;
+    }
+}
+
+void HCSetCompact(HCSetRef self) {
+    // Discard the live counts, which are only needed while holes remain
+    free(self->liveCounts);
+    self->liveCounts = NULL;
+    
+    // Nothing to do when no objects have been removed since the last compaction
+    if (self->entryCount == self->count) {
+        return;
+    }
+    
+    // Move entries down over holes left by removed objects, preserving their order
+    HCInteger* entryIndexMap = malloc(self->entryCount * sizeof(HCInteger));
+    HCInteger compactedCount = 0;
+    for (HCInteger entryIndex = 0; entryIndex < self->entryCount; entryIndex++) {
+        if (self->entries[entryIndex].object == NULL) {
+            entryIndexMap[entryIndex] = HCSetNotFound;
+            continue;
+        }
+        entryIndexMap[entryIndex] = compactedCount;
+        self->entries[compactedCount] = self->entries[entryIndex];
+        compactedCount++;
+    }
+    self->entryCount = compactedCount;
+    
+    // Point the slots at the moved entries
     for (HCInteger slotIndex = 0; slotIndex < self->capacity; slotIndex++) {
-        HCSetSlot* slot = self->slots[slotIndex].next;
-        while (slot != NULL) {
-            HCSetSlot* next = slot->next;
-            free(slot);
-            slot = next;
+        HCInteger entryIndex = self->slots[slotIndex];
+        if (entryIndex != HCSetNotFound) {
+            self->slots[slotIndex] = entryIndexMap[entryIndex];
         }
     }
-    free(self->slots);
+    free(entryIndexMap);
+}
+
+void HCSetLiveCountsBuild(HCSetRef self) {
+    // Count the objects in each entry, then add the count of each node of the tree to its parent, whose range of entries contains its own
+    // NOTE: The node at 1-based position p counts the objects in the (p & -p) entries ending at entry p - 1, and is stored at index p - 1
+    HCInteger* liveCounts = malloc(self->entryCapacity * sizeof(HCInteger));
+    // TODO: Check that the allocation proceeded successfully, determine how to pass the error otherwise
+    for (HCInteger entryIndex = 0; entryIndex < self->entryCapacity; entryIndex++) {
+        liveCounts[entryIndex] = entryIndex < self->entryCount && self->entries[entryIndex].object != NULL ? 1 : 0;
+    }
+    for (HCInteger position = 1; position <= self->entryCapacity; position++) {
+        HCInteger parentPosition = position + (position & -position);
+        if (parentPosition <= self->entryCapacity) {
+            liveCounts[parentPosition - 1] += liveCounts[position - 1];
+        }
+    }
+    self->liveCounts = liveCounts;
+}
+
+void HCSetLiveCountsAdd(HCSetRef self, HCInteger entryIndex, HCInteger delta) {
+    // Update every node whose range of entries contains the entry
+    for (HCInteger position = entryIndex + 1; position <= self->entryCapacity; position += position & -position) {
+        self->liveCounts[position - 1] += delta;
+    }
+}
+
+HCInteger HCSetLiveCountsFindEntryIndex(HCSetRef self, HCInteger index) {
+    // Descend from the largest node, advancing past each node whose objects all precede the object at the iteration index
+    HCInteger step = 1;
+    while (step * 2 <= self->entryCapacity) {
+        step *= 2;
+    }
+    HCInteger position = 0;
+    HCInteger remaining = index + 1;
+    for (; step > 0; step /= 2) {
+        if (position + step <= self->entryCapacity && self->liveCounts[position + step - 1] < remaining) {
+            position += step;
+            remaining -= self->liveCounts[position - 1];
+        }
+    }
+    
+    // The position reached is the 1-based position of the entry preceding the object, which is the entry index of the object
+    return position;
+}
+
+void HCSetRemoveSlotAtIndex(HCSetRef self, HCInteger slotIndex) {
+    // Release the object, leaving a hole in the entries array and in the probe sequence
+    HCInteger entryIndex = self->slots[slotIndex];
+    HCSetEntry* entry = &self->entries[entryIndex];
+    HCRelease(entry->object);
+    entry->object = NULL;
+    entry->hash = 0;
+    self->count--;
+    
+    // Drop trailing holes from the entries array so that removing the most recently added object leaves no hole
+    while (self->entryCount > 0 && self->entries[self->entryCount - 1].object == NULL) {
+        self->entryCount--;
+    }
+    
+    // Remove the object from the live counts, building them instead when this is the first hole not at the end of the entries
+    if (self->liveCounts != NULL) {
+        HCSetLiveCountsAdd(self, entryIndex, -1);
+    }
+    else if (self->entryCount != self->count) {
+        HCSetLiveCountsBuild(self);
+    }
+    
+    // Close the hole in the probe sequence by shifting back following slots that are allowed to occupy it
+    // NOTE: A slot may fill the hole when the hole lies between its ideal slot and its current slot, which keeps the table free of tombstones
+    HCInteger mask = self->capacity - 1;
+    HCInteger holeIndex = slotIndex;
+    for (HCInteger index = (holeIndex + 1) & mask; self->slots[index] != HCSetNotFound; index = (index + 1) & mask) {
+        HCInteger idealIndex = HCSetSlotIndexForHash(self, self->entries[self->slots[index]].hash);
+        if (((index - idealIndex) & mask) >= ((index - holeIndex) & mask)) {
+            self->slots[holeIndex] = self->slots[index];
+            holeIndex = index;
+        }
+    }
+    self->slots[holeIndex] = HCSetNotFound;
 }
 
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -87,10 +253,13 @@ HCBoolean HCSetIsEqual(HCSetRef self, HCSetRef other) {
 }
 
 HCInteger HCSetHashValue(HCSetRef self) {
+    // NOTE: Object hashes are summed so that equal sets hash equally regardless of their insertion order
     HCInteger hash = 5381;
-    for (HCSetIterator i = HCSetIterationBegin(self); !HCSetIterationHasEnded(&i); HCSetIterationNext(&i)) {
-        HCInteger objectHash = HCHashValue(i.object);
-        hash = ((hash << 5) + hash) + objectHash;
+    for (HCInteger entryIndex = 0; entryIndex < self->entryCount; entryIndex++) {
+        HCSetEntry* entry = &self->entries[entryIndex];
+        if (entry->object != NULL) {
+            hash += entry->hash;
+        }
     }
     return hash;
 }
@@ -120,7 +289,7 @@ HCInteger HCSetCount(HCSetRef self) {
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Searching
 //----------------------------------------------------------------------------------------------------------------------------------
-void HCSetFindSlotContainingObject(HCSetRef self, HCRef object, HCInteger* objectSlotIndex, HCBoolean* found, HCSetSlot** resultSlot) {
+void HCSetFindSlotContainingObject(HCSetRef self, HCRef object, HCInteger* objectSlotIndex, HCBoolean* found, HCSetEntry** resultEntry, HCInteger* objectHashValue) {
     // Report failure on requests to find the null object
     if (object == NULL) {
         if (objectSlotIndex != NULL) {
@@ -129,61 +298,47 @@ void HCSetFindSlotContainingObject(HCSetRef self, HCRef object, HCInteger* objec
         if (found != NULL) {
             *found = false;
         }
-        if (resultSlot != NULL) {
-            *resultSlot = NULL;
+        if (resultEntry != NULL) {
+            *resultEntry = NULL;
+        }
+        if (objectHashValue != NULL) {
+            *objectHashValue = 0;
         }
         return;
     }
     
-    // Find the slot index the object should occupy
+    // Probe linearly from the ideal slot index for the object, comparing cached hashes before checking equality
+    // NOTE: The load factor guarantees an empty slot exists, which terminates the probe when the object is not in the set
     HCInteger objectHash = HCHashValue(object);
-    HCInteger slotIndex = objectHash % self->capacity;
-    HCSetSlot* slot = &self->slots[slotIndex];
+    HCInteger mask = self->capacity - 1;
+    HCInteger slotIndex = HCSetSlotIndexForHash(self, objectHash);
+    HCSetEntry* entry = NULL;
+    for (; self->slots[slotIndex] != HCSetNotFound; slotIndex = (slotIndex + 1) & mask) {
+        HCSetEntry* candidate = &self->entries[self->slots[slotIndex]];
+        if (candidate->hash == objectHash && HCIsEqual(candidate->object, object)) {
+            entry = candidate;
+            break;
+        }
+    }
+    
+    // Report the slot containing the object, or the empty slot the object should occupy
     if (objectSlotIndex != NULL) {
         *objectSlotIndex = slotIndex;
     }
-    
-    // Find an empty slot in the linked list at the slot index, checking for equal objects along the way
-    if (found != NULL || resultSlot != NULL) {
-        while (true) {
-            if (slot->object != NULL && HCIsEqual(slot->object, object)) {
-                if (found != NULL) {
-                    *found = true;
-                }
-                if (resultSlot != NULL) {
-                    *resultSlot = slot;
-                }
-                return;
-            }
-            if (slot->next == NULL) {
-                if (found != NULL) {
-                    *found = false;
-                }
-                if (resultSlot != NULL) {
-                    *resultSlot = slot;
-                }
-                return;
-            }
-            slot = slot->next;
-        }
+    if (found != NULL) {
+        *found = entry != NULL;
     }
-}
-
-HCInteger HCSetNextSlotFromSlot(HCSetRef self, HCInteger index) {
-    // Iterate to find the next occupied slot
-    // TODO: How to determine this more effectively?
-    HCInteger startSlotIndex = index == HCSetNotFound ? 0 : (index + 1);
-    for (HCInteger slotIndex = startSlotIndex; slotIndex < self->capacity; slotIndex++) {
-        if (self->slots[slotIndex].object != NULL) {
-            return slotIndex;
-        }
+    if (resultEntry != NULL) {
+        *resultEntry = entry;
+    }
+    if (objectHashValue != NULL) {
+        *objectHashValue = objectHash;
     }
-    return HCSetNotFound;
 }
 
 HCBoolean HCSetContainsObject(HCSetRef self, HCRef object) {
     HCBoolean found = false;
-    HCSetFindSlotContainingObject(self, object, NULL, &found, NULL);
+    HCSetFindSlotContainingObject(self, object, NULL, &found, NULL, NULL);
     return found;
 }
 
@@ -196,98 +351,103 @@ HCRef HCSetLastObject(HCSetRef self) {
 }
 
 HCRef HCSetObjectAtIterationIndex(HCSetRef self, HCInteger index) {
-    // Iterate to the index requested and return the object found there
-    HCSetIterator i = HCSetIterationBegin(self);
-    HCRef object = i.object;
-    while (HCSetIterationHasNext(&i)) {
-        HCSetIterationNext(&i);
-        if (i.index == index) {
-            object = i.object;
-        }
+    // Iteration indices correspond directly to entry indices when there are no holes left by removed objects
+    if (index < 0 || index >= self->count) {
+        return NULL;
+    }
+    if (self->entryCount == self->count) {
+        return self->entries[index].object;
     }
-    HCSetIterationEnd(&i);
-    return object;
+    
+    // Otherwise find the entry holding the object at the iteration index using the live counts, which are kept while holes remain
+    return self->entries[HCSetLiveCountsFindEntryIndex(self, index)].object;
 }
 
 HCRef HCSetObjectEqualToObject(HCSetRef self, HCRef object) {
-    HCBoolean found = false;
-    HCSetSlot* slot = NULL;
-    HCSetFindSlotContainingObject(self, object, NULL, &found, &slot);
-    if (!found) {
-        return NULL;
-    }
-    return slot->object;
+    HCSetEntry* entry = NULL;
+    HCSetFindSlotContainingObject(self, object, NULL, NULL, &entry, NULL);
+    return entry == NULL ? NULL : entry->object;
 }
 
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Operations
 //----------------------------------------------------------------------------------------------------------------------------------
 void HCSetClear(HCSetRef self) {
-    // Release all object references in all slots and set count to zero
-    // TODO: Track first / last occupied slot or a linked-list of slots to shorten operation
-    for (HCInteger slotIndex = 0; slotIndex < self->capacity; slotIndex++) {
-        HCSetSlot* slot = &self->slots[slotIndex];
-        do {
-            HCRelease(slot->object);
-            slot->object = NULL;
-            HCSetSlot* next = slot->next;
-            slot = next;
-        } while (slot != NULL);
+    // Release all object references in all entries in batches, mark all slots empty, and set count to zero
+    HCRef objects[HCSetClearBatchCountStatic];
+    for (HCInteger entryIndex = 0; entryIndex < self->entryCount;) {
+        HCInteger batchCount = 0;
+        while (batchCount < HCSetClearBatchCountStatic && entryIndex < self->entryCount) {
+            objects[batchCount++] = self->entries[entryIndex++].object;
+        }
+        HCReleaseArray(objects, batchCount);
     }
+    memset(self->slots, 0xFF, self->capacity * sizeof(HCInteger));
+    free(self->liveCounts);
+    self->liveCounts = NULL;
+    self->entryCount = 0;
     self->count = 0;
 }
 
 void HCSetAddObject(HCSetRef self, HCRef object) {
-    // TODO: Check capacity, if it is greater than expand threshold, expand and rehash
-    
-    // Find the slot index the object should occupy, as well as the end slot at that index
-    HCSetSlot* slot = NULL;
-    HCBoolean found = false;
-    HCSetFindSlotContainingObject(self, object, NULL, &found, &slot);
+    // Find the slot containing an equal object, or the empty slot the object should occupy, keeping the hash of the object
+    HCInteger slotIndex = HCSetNotFound;
+    HCSetEntry* entry = NULL;
+    HCInteger objectHash = 0;
+    HCSetFindSlotContainingObject(self, object, &slotIndex, NULL, &entry, &objectHash);
+    if (slotIndex == HCSetNotFound) {
+        return;
+    }
     
-    // Where an equal object was already found in the set, replace it, otherwise add it to the set
-    // NOTE: Slots at the head of the list at the slot index are treated differently than linked slots
-    if (found) {
-        HCRef previousObject = slot->object;
-        slot->object = HCRetain(object);
+    // Where an equal object was already found in the set, replace it in place so it keeps its iteration index
+    if (entry != NULL) {
+        HCRef previousObject = entry->object;
+        entry->object = HCRetain(object);
         HCRelease(previousObject);
+        return;
     }
-    else {
-        if (slot->object != NULL) {
-            HCSetSlot* next = slot->next;
-            slot->next = malloc(sizeof(HCSetSlot));
-            slot = slot->next;
-            slot->next = next;
+    
+    // When the entries array is full, compact it if enough objects have been removed, otherwise expand and rehash
+    // NOTE: The empty slot the object should occupy must be found again, since rehashing moves slots
+    if (self->entryCount == self->entryCapacity) {
+        HCSetResize(self, self->count * 2 <= self->entryCount ? self->capacity : self->capacity * 2);
+        slotIndex = HCSetSlotIndexForHash(self, objectHash);
+        while (self->slots[slotIndex] != HCSetNotFound) {
+            slotIndex = (slotIndex + 1) & (self->capacity - 1);
         }
-        slot->object = HCRetain(object);
-        self->count++;
     }
+    
+    // Append the object to the entries and index it in its slot, counting it in the live counts while holes remain
+    if (self->liveCounts != NULL) {
+        HCSetLiveCountsAdd(self, self->entryCount, 1);
+    }
+    self->entries[self->entryCount].object = HCRetain(object);
+    self->entries[self->entryCount].hash = objectHash;
+    self->slots[slotIndex] = self->entryCount;
+    self->entryCount++;
+    self->count++;
 }
 
 void HCSetRemoveObject(HCSetRef self, HCRef object) {
-    // Find the slot index the object should occupy, as well as the slot to which it is linked
-    HCSetSlot* slot = NULL;
+    // Find the slot containing the object
     HCInteger slotIndex = HCSetNotFound;
     HCBoolean found = false;
-    HCSetFindSlotContainingObject(self, object, &slotIndex, &found, &slot);
-    
-    // Given that the object was in the set, unlink it from its slot and clean the slot up where needed
-    // NOTE: Slots at the head of the list at the slot index are treated differently than linked slots
-    if (found) {
-        HCRelease(slot->object);
-        self->count--;
-        HCSetSlot* nextSlot = slot->next;
-        if (nextSlot == NULL) {
-            slot->object = NULL;
-        }
-        else {
-            slot->object = nextSlot->object;
-            slot->next = nextSlot->next;
-            free(nextSlot);
-        }
+    HCSetFindSlotContainingObject(self, object, &slotIndex, &found, NULL, NULL);
+    if (!found) {
+        return;
     }
     
-    // TODO: Check capacity, if it is smaller than contract threshold, contract and rehash
+    // Remove the object, closing the gap in the probe sequence it leaves behind
+    HCSetRemoveSlotAtIndex(self, slotIndex);
+    
+    // Contract and rehash when the set has become sparse, otherwise compact the entries once holes make up over a quarter of them
+    // NOTE: Compacting only when modifying the set keeps reading from it free of writes, so the set may be read from multiple threads
+    if (self->capacity > HCSetMinimumCapacityStatic && self->count * 4 < HCSetEntryCapacityForSlotCount(self->capacity)) {
+        HCSetResize(self, self->capacity / 2);
+    }
+    else if ((self->entryCount - self->count) * 4 > self->entryCount) {
+        HCSetCompact(self);
+    }
 }
 
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -299,16 +459,15 @@ void HCSetAddObjectReleased(HCSetRef self, HCRef object) {
 }
 
 HCRef HCSetRemoveObjectRetained(HCSetRef self, HCRef object) {
-    // Find the slot index the object should occupy, as well as the end slot at that index
-    HCSetSlot* slot = NULL;
-    HCBoolean found = false;
-    HCSetFindSlotContainingObject(self, object, NULL, &found, &slot);
-    
-    // Retain the matching object if found, remove it from the set, and return it
-    HCRef foundObject = slot->object;
-    if (found) {
-        HCRetain(foundObject);
+    // Find the entry containing the object
+    HCSetEntry* entry = NULL;
+    HCSetFindSlotContainingObject(self, object, NULL, NULL, &entry, NULL);
+    if (entry == NULL) {
+        return NULL;
     }
+    
+    // Retain the matching object, remove it from the set, and return it
+    HCRef foundObject = HCRetain(entry->object);
     HCSetRemoveObject(self, object);
     return foundObject;
 }
@@ -317,65 +476,40 @@ HCRef HCSetRemoveObjectRetained(HCSetRef self, HCRef object) {
 // MARK: - Iteration
 //----------------------------------------------------------------------------------------------------------------------------------
 HCSetIterator HCSetIterationBegin(HCSetRef self) {
-    // Begin iteration with the object in the first slot
+    // Iteration visits objects in insertion order, skipping holes left by removed objects
     HCSetIterator iterator = HCSetIteratorInvalid;
-    HCInteger firstSlotIndex = HCSetNextSlotFromSlot(self, HCSetNotFound);
-    if (firstSlotIndex < 0 || firstSlotIndex >= self->capacity) {
+    if (self->count == 0) {
         HCSetIterationEnd(&iterator);
         return iterator;
     }
     
-    // Load the first slot and prepare the iterator there
-    HCSetSlot* slot = &self->slots[firstSlotIndex];
+    // Prepare the iterator at the first entry containing an object
+    HCSetEntry* entry = &self->entries[0];
+    while (entry->object == NULL) {
+        entry++;
+    }
     iterator.set = self;
     iterator.index = 0;
-    iterator.object = slot->object;
-    iterator.state = slot;
-    
-    // Determine if the set has no locations to iterate on
-    // TODO: Is a count check sufficient?
-    if (HCSetIterationHasEnded(&iterator)) {
-        HCSetIterationEnd(&iterator);
-    }
+    iterator.object = entry->object;
+    iterator.state = entry;
     return iterator;
 }
 
 void HCSetIterationNext(HCSetIterator* iterator) {
-    // Check the iteration state for the slot returned by the last call to next
-    HCInteger startSlotIndex = HCSetNotFound;
-    if (iterator->state != NULL) {
-        HCSetSlot* previousSlot = iterator->state;
-        
-        // Where the last slot has another entry, it is the next iteration result
-        if (previousSlot->next != NULL) {
-            iterator->state = previousSlot->next;
-            iterator->object = previousSlot->next->object;
-            iterator->index++;
-            return;
-        }
-        
-        // Obtain the slot index for the last iteration result for use in determining the next result
-        HCSetFindSlotContainingObject(iterator->set, previousSlot->object, &startSlotIndex, NULL, NULL);
-    }
-    
-    // Start at the beginning of the slot array when previous iteration data cannot be determined
-    if (startSlotIndex == HCSetNotFound) {
-        startSlotIndex = 0;
-    }
-    
-    // Find the next occupied slot in the slot array
-    HCInteger slotIndex = HCSetNextSlotFromSlot(iterator->set, startSlotIndex);
-    if (slotIndex == HCSetNotFound) {
+    // End iteration when moving past the last entry
+    if (!HCSetIterationHasNext(iterator)) {
         HCSetIterationEnd(iterator);
+        return;
     }
-    else {
-        HCSetSlot* slot = &iterator->set->slots[slotIndex];
-        if (slot->object != NULL) {
-            iterator->state = slot;
-            iterator->object = slot->object;
-            iterator->index++;
-        }
+    
+    // Move to the entry containing an object following the entry of the current iteration result
+    HCSetEntry* entry = (HCSetEntry*)iterator->state + 1;
+    while (entry->object == NULL) {
+        entry++;
     }
+    iterator->state = entry;
+    iterator->object = entry->object;
+    iterator->index++;
 }
 
 void HCSetIterationEnd(HCSetIterator* iterator) {
@@ -389,7 +523,7 @@ HCBoolean HCSetIterationHasBegun(HCSetIterator* iterator) {
 }
 
 HCBoolean HCSetIterationHasNext(HCSetIterator* iterator) {
-    return iterator->set != NULL && iterator->index < iterator->set->count - 1;
+    return iterator->set != NULL && iterator->state != NULL && iterator->index < iterator->set->count - 1;
 }
 
 HCBoolean HCSetIterationHasEnded(HCSetIterator* iterator) {
@@ -16,19 +16,33 @@
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Definitions
 //----------------------------------------------------------------------------------------------------------------------------------
-typedef struct HCSetSlot {
+#define HCSetMinimumCapacityStatic (8)
+#define HCSetLoadFactorNumeratorStatic (3)
+#define HCSetLoadFactorDenominatorStatic (4)
+#define HCSetClearBatchCountStatic (64)
+
+typedef struct HCSetEntry {
     HCRef object;
-    struct HCSetSlot* next;
-} HCSetSlot;
+    HCInteger hash;
+} HCSetEntry;
 
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Object Type
 //----------------------------------------------------------------------------------------------------------------------------------
+// NOTE: Objects are stored in insertion order in the dense entries array, while the slots array is an open-addressing index into it.
+//       Removed objects leave holes in the entries array, which readers skip. Holes are compacted when the set is modified, once they
+//       make up over a quarter of the entries or when the set is resized.
+//       While holes remain, the live counts form a Fenwick tree over the entries counting the objects they hold, which finds the entry at an
+//       iteration index in logarithmic time. They are built when the first hole not at the end of the entries is left, and discarded on compaction.
 typedef struct HCSet {
     HCObject base;
     HCInteger count;
     HCInteger capacity;
-    HCSetSlot* slots;
+    HCInteger* slots;
+    HCInteger entryCount;
+    HCInteger entryCapacity;
+    HCSetEntry* entries;
+    HCInteger* liveCounts;
 } HCSet;
 
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -37,10 +51,22 @@ typedef struct HCSet {
 void HCSetInit(void* memory, HCInteger capacity);
 void HCSetDestroy(HCSetRef self);
 
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Storage
+//----------------------------------------------------------------------------------------------------------------------------------
+HCInteger HCSetSlotCountForCapacity(HCInteger capacity);
+HCInteger HCSetEntryCapacityForSlotCount(HCInteger slotCount);
+HCInteger HCSetSlotIndexForHash(HCSetRef self, HCInteger hash);
+void HCSetResize(HCSetRef self, HCInteger slotCount);
+void HCSetCompact(HCSetRef self);
+void HCSetLiveCountsBuild(HCSetRef self);
+void HCSetLiveCountsAdd(HCSetRef self, HCInteger entryIndex, HCInteger delta);
+HCInteger HCSetLiveCountsFindEntryIndex(HCSetRef self, HCInteger index);
+void HCSetRemoveSlotAtIndex(HCSetRef self, HCInteger slotIndex);
+
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Searching
 //----------------------------------------------------------------------------------------------------------------------------------
-void HCSetFindSlotContainingObject(HCSetRef self, HCRef object, HCInteger* objectSlotIndex, HCBoolean* found, HCSetSlot** resultSlot);
-HCInteger HCSetNextSlotFromSlot(HCSetRef self, HCInteger index);
+void HCSetFindSlotContainingObject(HCSetRef self, HCRef object, HCInteger* objectSlotIndex, HCBoolean* found, HCSetEntry** resultEntry, HCInteger* objectHashValue);
 
 #endif /* HCSet_Internal_h */
@@ -0,0 +1,173 @@
+///
+/// @file HCAllocator.c
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#include "HCAllocator_Internal.h"
+#include <string.h>
+#include <pthread.h>
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Definitions
+//----------------------------------------------------------------------------------------------------------------------------------
+typedef struct HCAllocatorBlock {
+    struct HCAllocatorBlock* next;
+} HCAllocatorBlock;
+
+// NOTE: The slab header is padded so that blocks following it keep the alignment of the slab allocation
+typedef struct HCAllocatorSlab {
+    struct HCAllocatorSlab* next;
+    HCInteger sizeClass;
+} HCAllocatorSlab;
+
+typedef struct HCAllocatorThreadCache {
+    HCAllocatorBlock* blocks[HCAllocatorSizeClassCountStatic + 1];
+    HCInteger blockCounts[HCAllocatorSizeClassCountStatic + 1];
+    HCBoolean isRegistered;
+} HCAllocatorThreadCache;
+
+/// Lock protecting the shared free lists and slab lists.
+static pthread_mutex_t HCAllocatorLock = PTHREAD_MUTEX_INITIALIZER;
+/// Shared free lists of each size class, from which thread caches are refilled.
+static HCAllocatorBlock* HCAllocatorBlocks[HCAllocatorSizeClassCountStatic + 1];
+/// Slabs allocated for each size class, which are kept for the lifetime of the process.
+static HCAllocatorSlab* HCAllocatorSlabs[HCAllocatorSizeClassCountStatic + 1];
+/// Free blocks cached by the current thread.
+static _Thread_local HCAllocatorThreadCache HCAllocatorThreadCacheInstance;
+
+/// The @c pthread_once_t used ensure that @c HCAllocatorThreadCacheKey is only initialized once.
+static pthread_once_t HCAllocatorThreadCacheKeyOnce = PTHREAD_ONCE_INIT;
+/// The @c pthread_key_t used to return the blocks cached by a thread when it exits.
+static pthread_key_t HCAllocatorThreadCacheKey;
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Thread Cache
+//----------------------------------------------------------------------------------------------------------------------------------
+/// Moves cached blocks of a size class from a thread cache to the shared free list, keeping at most @c keepCount blocks.
+/// @note Must be called with @c HCAllocatorLock held.
+static void HCAllocatorThreadCacheFlushLocked(HCAllocatorThreadCache* cache, HCInteger sizeClass, HCInteger keepCount) {
+    while (cache->blockCounts[sizeClass] > keepCount) {
+        HCAllocatorBlock* block = cache->blocks[sizeClass];
+        cache->blocks[sizeClass] = block->next;
+        cache->blockCounts[sizeClass]--;
+        block->next = HCAllocatorBlocks[sizeClass];
+        HCAllocatorBlocks[sizeClass] = block;
+    }
+}
+
+/// The destructor of @c HCAllocatorThreadCacheKey, which returns all blocks cached by an exiting thread.
+static void HCAllocatorThreadCacheDestroy(void* value) {
+    HCAllocatorThreadCache* cache = value;
+    pthread_mutex_lock(&HCAllocatorLock);
+    for (HCInteger sizeClass = 1; sizeClass <= HCAllocatorSizeClassCountStatic; sizeClass++) {
+        HCAllocatorThreadCacheFlushLocked(cache, sizeClass, 0);
+    }
+    pthread_mutex_unlock(&HCAllocatorLock);
+    cache->isRegistered = false;
+}
+
+/// The function called when @c HCAllocatorThreadCacheKeyOnce hasn't been run.
+static void HCAllocatorSetupThreadCacheKey(void) {
+    pthread_key_create(&HCAllocatorThreadCacheKey, HCAllocatorThreadCacheDestroy);
+}
+
+/// Registers a thread cache so its blocks are returned when the thread exits.
+static void HCAllocatorThreadCacheRegister(HCAllocatorThreadCache* cache) {
+    pthread_once(&HCAllocatorThreadCacheKeyOnce, HCAllocatorSetupThreadCacheKey);
+    pthread_setspecific(HCAllocatorThreadCacheKey, cache);
+    cache->isRegistered = true;
+}
+
+/// Refills the thread cache of a size class from the shared free list, allocating a new slab if the shared free list is empty.
+static void HCAllocatorThreadCacheRefill(HCAllocatorThreadCache* cache, HCInteger sizeClass) {
+    if (!cache->isRegistered) {
+        HCAllocatorThreadCacheRegister(cache);
+    }
+    
+    pthread_mutex_lock(&HCAllocatorLock);
+    
+    // Carve a new slab into blocks if there are no shared blocks
+    if (HCAllocatorBlocks[sizeClass] == NULL) {
+        HCAllocatorSlab* slab = malloc(HCAllocatorSlabSizeStatic);
+        if (slab == NULL) {
+            pthread_mutex_unlock(&HCAllocatorLock);
+            return;
+        }
+        slab->next = HCAllocatorSlabs[sizeClass];
+        slab->sizeClass = sizeClass;
+        HCAllocatorSlabs[sizeClass] = slab;
+        HCInteger blockSize = HCAllocatorSizeForSizeClass(sizeClass);
+        HCInteger blockCount = (HCAllocatorSlabSizeStatic - (HCInteger)sizeof(HCAllocatorSlab)) / blockSize;
+        HCByte* blocks = (HCByte*)(slab + 1);
+        for (HCInteger blockIndex = blockCount - 1; blockIndex >= 0; blockIndex--) {
+            HCAllocatorBlock* block = (HCAllocatorBlock*)(blocks + blockIndex * blockSize);
+            block->next = HCAllocatorBlocks[sizeClass];
+            HCAllocatorBlocks[sizeClass] = block;
+        }
+    }
+    
+    // Move a batch of shared blocks to the thread cache
+    for (HCInteger blockIndex = 0; blockIndex < HCAllocatorThreadCacheBatchCountStatic && HCAllocatorBlocks[sizeClass] != NULL; blockIndex++) {
+        HCAllocatorBlock* block = HCAllocatorBlocks[sizeClass];
+        HCAllocatorBlocks[sizeClass] = block->next;
+        block->next = cache->blocks[sizeClass];
+        cache->blocks[sizeClass] = block;
+        cache->blockCounts[sizeClass]++;
+    }
+    
+    pthread_mutex_unlock(&HCAllocatorLock);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Allocation
+//----------------------------------------------------------------------------------------------------------------------------------
+HCInteger HCAllocatorSizeClassForSize(HCInteger size) {
+    if (!HCAllocatorEnabledStatic || size <= 0 || size > HCAllocatorSizeClassCountStatic * HCAllocatorSizeClassGranularityStatic) {
+        return HCAllocatorSizeClassNoneStatic;
+    }
+    return (size + HCAllocatorSizeClassGranularityStatic - 1) / HCAllocatorSizeClassGranularityStatic;
+}
+
+HCInteger HCAllocatorSizeForSizeClass(HCInteger sizeClass) {
+    return sizeClass * HCAllocatorSizeClassGranularityStatic;
+}
+
+void* HCAllocatorAllocate(HCInteger sizeClass) {
+    // Take a block from the thread cache, refilling it when empty
+    HCAllocatorThreadCache* cache = &HCAllocatorThreadCacheInstance;
+    if (cache->blocks[sizeClass] == NULL) {
+        HCAllocatorThreadCacheRefill(cache, sizeClass);
+        if (cache->blocks[sizeClass] == NULL) {
+            return NULL;
+        }
+    }
+    HCAllocatorBlock* block = cache->blocks[sizeClass];
+    cache->blocks[sizeClass] = block->next;
+    cache->blockCounts[sizeClass]--;
+    
+    // NOTE: Blocks are zeroed to match the calloc() allocations they replace
+    memset(block, 0, HCAllocatorSizeForSizeClass(sizeClass));
+    return block;
+}
+
+void HCAllocatorDeallocate(void* memory, HCInteger sizeClass) {
+    // Return the block to the thread cache, returning a batch to the shared free list when the cache is full
+    // NOTE: Blocks may be deallocated on a different thread than they were allocated on
+    HCAllocatorThreadCache* cache = &HCAllocatorThreadCacheInstance;
+    if (!cache->isRegistered) {
+        HCAllocatorThreadCacheRegister(cache);
+    }
+    HCAllocatorBlock* block = memory;
+    block->next = cache->blocks[sizeClass];
+    cache->blocks[sizeClass] = block;
+    cache->blockCounts[sizeClass]++;
+    if (cache->blockCounts[sizeClass] > HCAllocatorThreadCacheLimitStatic) {
+        pthread_mutex_lock(&HCAllocatorLock);
+        HCAllocatorThreadCacheFlushLocked(cache, sizeClass, HCAllocatorThreadCacheLimitStatic - HCAllocatorThreadCacheBatchCountStatic);
+        pthread_mutex_unlock(&HCAllocatorLock);
+    }
+}
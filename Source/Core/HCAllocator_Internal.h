@@ -0,0 +1,45 @@
+///
+/// @file HCAllocator_Internal.h
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#ifndef HCAllocator_Internal_h
+#define HCAllocator_Internal_h
+
+#include "HCCore.h"
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Definitions
+//----------------------------------------------------------------------------------------------------------------------------------
+// NOTE: Object allocations up to the largest size class are carved from slabs shared by all objects of the same size class.
+//       Each thread caches free blocks of each size class, and exchanges them with the shared free lists in batches.
+//       The slab allocator can be disabled by defining HCAllocatorDisabled, in which case all allocations use the C library, so
+//       memory checking tools like valgrind can track individual objects.
+#if !defined(HCAllocatorDisabled)
+#define HCAllocatorEnabledStatic (1)
+#else
+#define HCAllocatorEnabledStatic (0)
+#endif
+
+#define HCAllocatorSizeClassGranularityStatic (16)
+#define HCAllocatorSizeClassCountStatic (16)
+#define HCAllocatorSlabSizeStatic (64 * 1024)
+#define HCAllocatorThreadCacheBatchCountStatic (32)
+#define HCAllocatorThreadCacheLimitStatic (128)
+
+/// Size class of allocations not made from slabs.
+#define HCAllocatorSizeClassNoneStatic (0)
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Allocation
+//----------------------------------------------------------------------------------------------------------------------------------
+HCInteger HCAllocatorSizeClassForSize(HCInteger size);
+HCInteger HCAllocatorSizeForSizeClass(HCInteger sizeClass);
+void* HCAllocatorAllocate(HCInteger sizeClass);
+void HCAllocatorDeallocate(void* memory, HCInteger sizeClass);
+
+#endif /* HCAllocator_Internal_h */
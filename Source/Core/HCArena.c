@@ -0,0 +1,161 @@
+///
+/// @file HCArena.c
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#include "HCArena_Internal.h"
+#include <string.h>
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Type
+//----------------------------------------------------------------------------------------------------------------------------------
+const HCObjectTypeData HCArenaTypeDataInstance = {
+    .base = {
+        .ancestor = &HCObjectTypeDataInstance.base,
+        .name = "HCArena",
+        .identifier = HCTypeIdentifierArena,
+        .kindMask = HCTypeKindMaskForIdentifier(HCTypeIdentifierObject) | HCTypeKindMaskForIdentifier(HCTypeIdentifierArena),
+    },
+    .isEqual = (void*)HCArenaIsEqual,
+    .hashValue = (void*)HCArenaHashValue,
+    .print = (void*)HCArenaPrint,
+    .destroy = (void*)HCArenaDestroy,
+};
+HCType HCArenaType = (HCType)&HCArenaTypeDataInstance;
+
+/// The arena in which objects created on the current thread are allocated, or @c NULL if they are allocated individually.
+static _Thread_local HCArenaRef HCArenaCurrent = NULL;
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Construction
+//----------------------------------------------------------------------------------------------------------------------------------
+HCArenaRef HCArenaCreate(void) {
+    // NOTE: Arenas are never allocated in another arena, since they would not be destroyed when released
+    HCArenaRef previous = HCArenaBeginCreatingObjects(NULL);
+    HCArenaRef self = HCObjectAllocate(sizeof(HCArena));
+    HCArenaEndCreatingObjects(previous);
+    HCArenaInit(self);
+    return self;
+}
+
+void HCArenaInit(void* memory) {
+    HCObjectInit(memory);
+    HCArenaRef self = memory;
+    self->base.type = HCArenaType;
+    self->blocks = NULL;
+    self->position = NULL;
+    self->end = NULL;
+    self->size = 0;
+    self->objectCount = 0;
+    self->objectCapacity = 0;
+    self->objects = NULL;
+}
+
+void HCArenaDestroy(HCArenaRef self) {
+    // Destroy objects in reverse creation order
+    // NOTE: Objects are not freed individually, since their memory is reclaimed with the blocks containing them
+    for (HCInteger objectIndex = self->objectCount - 1; objectIndex >= 0; objectIndex--) {
+        HCRef object = self->objects[objectIndex];
+        for (HCType type = HCObjectTypeOf(object); type != NULL; type = type->ancestor) {
+            ((HCObjectTypeData*)type)->destroy(object);
+        }
+    }
+    free(self->objects);
+    
+    // Free all blocks
+    HCArenaBlock* block = self->blocks;
+    while (block != NULL) {
+        HCArenaBlock* next = block->next;
+        free(block);
+        block = next;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Polymorphic Functions
+//----------------------------------------------------------------------------------------------------------------------------------
+HCBoolean HCArenaIsEqual(HCArenaRef self, HCArenaRef other) {
+    return HCObjectIsEqual((HCObjectRef)self, (HCObjectRef)other);
+}
+
+HCInteger HCArenaHashValue(HCArenaRef self) {
+    return HCObjectHashValue((HCObjectRef)self);
+}
+
+void HCArenaPrint(HCArenaRef self, FILE* stream) {
+    fprintf(stream, "<%s@%p,objects:%li,size:%li>", self->base.type->name, self, (long)self->objectCount, (long)self->size);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Attributes
+//----------------------------------------------------------------------------------------------------------------------------------
+HCInteger HCArenaObjectCount(HCArenaRef self) {
+    return self->objectCount;
+}
+
+HCInteger HCArenaSize(HCArenaRef self) {
+    return self->size;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Creation
+//----------------------------------------------------------------------------------------------------------------------------------
+HCRef HCArenaCreateObject(HCArenaRef self, HCArenaCreateFunction function, void* context) {
+    HCArenaRef previous = HCArenaBeginCreatingObjects(self);
+    HCRef object = function(context);
+    HCArenaEndCreatingObjects(previous);
+    return object;
+}
+
+HCArenaRef HCArenaGetCurrent(void) {
+    return HCArenaCurrent;
+}
+
+HCArenaRef HCArenaBeginCreatingObjects(HCArenaRef self) {
+    HCArenaRef previous = HCArenaCurrent;
+    HCArenaCurrent = self;
+    return previous;
+}
+
+void HCArenaEndCreatingObjects(HCArenaRef previous) {
+    HCArenaCurrent = previous;
+}
+
+void* HCArenaAllocateObject(HCArenaRef self, HCInteger size) {
+    // Start a new block if the object does not fit in the current block
+    // NOTE: Objects larger than the block size are given a block of their own
+    size = (size + HCArenaAlignmentStatic - 1) / HCArenaAlignmentStatic * HCArenaAlignmentStatic;
+    if (self->position == NULL || size > self->end - self->position) {
+        HCInteger blockSize = (HCInteger)sizeof(HCArenaBlock) + size > HCArenaBlockSizeStatic ? (HCInteger)sizeof(HCArenaBlock) + size : HCArenaBlockSizeStatic;
+        HCArenaBlock* block = malloc(blockSize);
+        if (block == NULL) {
+            return NULL;
+        }
+        block->next = self->blocks;
+        block->size = blockSize;
+        self->blocks = block;
+        self->position = (HCByte*)(block + 1);
+        self->end = (HCByte*)block + blockSize;
+        self->size += blockSize;
+    }
+    
+    // Record the object so it is destroyed with the arena
+    if (self->objectCount == self->objectCapacity) {
+        HCInteger increasedCapacity = self->objectCapacity == 0 ? 64 : self->objectCapacity * 2;
+        self->objects = realloc(self->objects, increasedCapacity * sizeof(HCRef));
+        self->objectCapacity = increasedCapacity;
+        // TODO: Failable
+    }
+    
+    // Bump allocate zeroed memory for the object
+    HCObjectRef object = (HCObjectRef)self->position;
+    self->position += size;
+    memset(object, 0, size);
+    object->sizeClass = HCObjectSizeClassArenaStatic;
+    self->objects[self->objectCount++] = object;
+    return object;
+}
@@ -0,0 +1,99 @@
+///
+/// @file HCArena.h
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+/// @brief Region of memory in which a graph of objects is allocated and reclaimed together.
+///
+
+#ifndef HCArena_h
+#define HCArena_h
+
+#include "HCObject.h"
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Type
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Type of @c HCArena instances.
+extern HCType HCArenaType;
+
+/// A reference to an @c HCArena instance.
+typedef struct HCArena* HCArenaRef;
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Other Definitions
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Function that creates objects in an arena using @c HCArenaCreateObject().
+/// @param context The context value passed to @c HCArenaCreateObject().
+/// @returns The object to be returned from @c HCArenaCreateObject().
+typedef HCRef (*HCArenaCreateFunction)(void* context);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Construction
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Creates an empty arena.
+///
+/// Objects created in an arena are allocated sequentially from large blocks of memory owned by the arena.
+/// Calling @c HCRetain() or @c HCRelease() on objects in an arena has no effect. Instead, all objects in an arena are destroyed together when the arena is destroyed.
+/// References to objects in an arena must not be used after the arena is destroyed, so objects in an arena should only be referenced by other objects in the same arena or by code that finishes with them before releasing the arena.
+///
+/// @returns A reference to the created arena.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it and all objects created in it when all references to are released.
+HCArenaRef HCArenaCreate(void);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Polymorphic Functions
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Determines if an arena is equal to another arena.
+/// @param self A reference to the arena to examine.
+/// @param other The other arena to evaluate equality against.
+/// @returns @c true if @c self and @c other are the same arena.
+HCBoolean HCArenaIsEqual(HCArenaRef self, HCArenaRef other);
+
+/// Calculates a hash value for an arena.
+/// @param self A reference to the arena.
+/// @returns A hash value determined using only the identity of the arena.
+HCInteger HCArenaHashValue(HCArenaRef self);
+
+/// Prints an arena to a stream.
+/// @param self A reference to the arena.
+/// @param stream The stream to which the arena should be printed.
+void HCArenaPrint(HCArenaRef self, FILE* stream);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Attributes
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Obtains the number of objects created in an arena.
+/// @param self A reference to the arena.
+/// @returns The number of objects created in the arena.
+HCInteger HCArenaObjectCount(HCArenaRef self);
+
+/// Obtains the size of the memory reserved by an arena for its objects.
+/// @param self A reference to the arena.
+/// @returns The size in bytes of the blocks of memory owned by the arena.
+HCInteger HCArenaSize(HCArenaRef self);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Creation
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Calls a function that creates objects, such that every object it creates on the calling thread is created in an arena.
+///
+/// Any construction function may be used in @c function, for example to create a graph of containers and their contents in the arena.
+/// Objects created in the arena must not be interned or otherwise stored in objects outside the arena that outlive it.
+///
+/// @param self A reference to the arena in which objects should be created.
+/// @param function The function that creates objects.
+/// @param context A value passed unmodified to @c function.
+/// @returns The object returned by @c function, which is valid until the arena is destroyed.
+HCRef HCArenaCreateObject(HCArenaRef self, HCArenaCreateFunction function, void* context);
+
+#endif /* HCArena_h */
@@ -0,0 +1,58 @@
+///
+/// @file HCArena_Internal.h
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#ifndef HCArena_Internal_h
+#define HCArena_Internal_h
+
+#include "HCObject_Internal.h"
+#include "HCArena.h"
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Definitions
+//----------------------------------------------------------------------------------------------------------------------------------
+#define HCArenaBlockSizeStatic (64 * 1024)
+#define HCArenaAlignmentStatic (16)
+
+// NOTE: The block header is padded so that objects following it keep the alignment of the block allocation
+typedef struct HCArenaBlock {
+    struct HCArenaBlock* next;
+    HCInteger size;
+} HCArenaBlock;
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Type
+//----------------------------------------------------------------------------------------------------------------------------------
+// NOTE: Objects are recorded in creation order so their destroy functions can be called when the arena is destroyed, which frees
+//       storage they own outside the arena and releases references they hold to objects outside the arena.
+typedef struct HCArena {
+    HCObject base;
+    HCArenaBlock* blocks;
+    HCByte* position;
+    HCByte* end;
+    HCInteger size;
+    HCInteger objectCount;
+    HCInteger objectCapacity;
+    HCRef* objects;
+} HCArena;
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Construction
+//----------------------------------------------------------------------------------------------------------------------------------
+void HCArenaInit(void* memory);
+void HCArenaDestroy(HCArenaRef self);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Creation
+//----------------------------------------------------------------------------------------------------------------------------------
+HCArenaRef HCArenaGetCurrent(void);
+HCArenaRef HCArenaBeginCreatingObjects(HCArenaRef self);
+void HCArenaEndCreatingObjects(HCArenaRef previous);
+void* HCArenaAllocateObject(HCArenaRef self, HCInteger size);
+
+#endif /* HCArena_Internal_h */
@@ -10,6 +10,7 @@
 #include "HCCore.h"
 #include <inttypes.h>
 #include <math.h>
+#include <string.h>
 
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Boolean Operations
@@ -83,3 +84,92 @@ HCInteger HCRealHashValue(HCReal self) {
 void HCRealPrint(HCReal self, FILE* stream) {
     fprintf(stream, "%f", self);
 }
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Memory Operations
+//----------------------------------------------------------------------------------------------------------------------------------
+// NOTE: The byte hash follows the construction of wyhash (public domain), which consumes 16 bytes per 64-bit multiply of the data
+//       The reads use the native byte order, so hash values differ between little-endian and big-endian platforms
+static const uint64_t HCBytesHashSecret[4] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+static inline void HCBytesHashMultiply(uint64_t* a, uint64_t* b) {
+    // Compute the full 128-bit product, placing the low bits in a and the high bits in b
+#if defined(__SIZEOF_INT128__)
+    __uint128_t product = (__uint128_t)*a * *b;
+    *a = (uint64_t)product;
+    *b = (uint64_t)(product >> 64);
+#else
+    uint64_t ha = *a >> 32, hb = *b >> 32, la = (uint32_t)*a, lb = (uint32_t)*b;
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32);
+    uint64_t c = t < rl;
+    uint64_t lo = t + (rm1 << 32);
+    c += lo < t;
+    uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+    *a = lo;
+    *b = hi;
+#endif
+}
+
+static inline uint64_t HCBytesHashMix(uint64_t a, uint64_t b) {
+    HCBytesHashMultiply(&a, &b);
+    return a ^ b;
+}
+
+static inline uint64_t HCBytesHashRead8(const HCByte* p) {
+    uint64_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline uint64_t HCBytesHashRead4(const HCByte* p) {
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+HCInteger HCBytesHashValue(HCInteger size, const HCByte* bytes) {
+    const HCByte* p = bytes;
+    uint64_t length = (uint64_t)size;
+    uint64_t seed = HCBytesHashMix(HCBytesHashSecret[0], HCBytesHashSecret[1]);
+    uint64_t a = 0;
+    uint64_t b = 0;
+    if (length <= 16) {
+        // Read short sequences as up to four overlapping 32-bit words, or three individual bytes
+        if (length >= 4) {
+            a = (HCBytesHashRead4(p) << 32) | HCBytesHashRead4(p + ((length >> 3) << 2));
+            b = (HCBytesHashRead4(p + length - 4) << 32) | HCBytesHashRead4(p + length - 4 - ((length >> 3) << 2));
+        }
+        else if (length > 0) {
+            a = ((uint64_t)p[0] << 16) | ((uint64_t)p[length >> 1] << 8) | p[length - 1];
+        }
+    }
+    else {
+        // Consume long sequences 48 bytes at a time in three independent lanes, then 16 bytes at a time
+        uint64_t remaining = length;
+        if (remaining > 48) {
+            uint64_t seed1 = seed;
+            uint64_t seed2 = seed;
+            do {
+                seed = HCBytesHashMix(HCBytesHashRead8(p) ^ HCBytesHashSecret[1], HCBytesHashRead8(p + 8) ^ seed);
+                seed1 = HCBytesHashMix(HCBytesHashRead8(p + 16) ^ HCBytesHashSecret[2], HCBytesHashRead8(p + 24) ^ seed1);
+                seed2 = HCBytesHashMix(HCBytesHashRead8(p + 32) ^ HCBytesHashSecret[3], HCBytesHashRead8(p + 40) ^ seed2);
+                p += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (remaining > 16) {
+            seed = HCBytesHashMix(HCBytesHashRead8(p) ^ HCBytesHashSecret[1], HCBytesHashRead8(p + 8) ^ seed);
+            p += 16;
+            remaining -= 16;
+        }
+        
+        // Read the final 16 bytes, which may overlap bytes already consumed
+        a = HCBytesHashRead8(p + remaining - 16);
+        b = HCBytesHashRead8(p + remaining - 8);
+    }
+    a ^= HCBytesHashSecret[1];
+    b ^= seed;
+    HCBytesHashMultiply(&a, &b);
+    return (HCInteger)HCBytesHashMix(a ^ HCBytesHashSecret[0] ^ length, b ^ HCBytesHashSecret[1]);
+}
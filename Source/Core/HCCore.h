@@ -211,6 +211,19 @@ HCInteger HCRealHashValue(HCReal self);
 /// @param stream Stream to which @c self will be printed.
 void HCRealPrint(HCReal self, FILE* stream);
 
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Memory Operations
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Provides a hashing value corresponding to a sequence of bytes.
+///
+/// Sequences containing the same bytes in the same order will hash to the same value. The hash is well distributed over all of its bits, and is not guaranteed to be the same across processes or platforms.
+///
+/// @param size The number of bytes to hash.
+/// @param bytes The bytes to hash. May be @c NULL if @c size is zero.
+/// @returns A value suitable to use as a hash value to represent the bytes or to combine with other values to form an aggregate hash value.
+HCInteger HCBytesHashValue(HCInteger size, const HCByte* bytes);
+
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Object Foundation
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -223,11 +236,42 @@ typedef const char* const HCTypeName;
 /// Contains the same value for all instances of a type.
 typedef const struct HCTypeData* HCType;
 
+/// Numeric identifiers of the types defined by HollowCore.
+/// Types defined elsewhere use @c HCTypeIdentifierNone, and are identified by name instead.
+typedef enum HCTypeIdentifier {
+    HCTypeIdentifierNone = 0,
+    HCTypeIdentifierObject,
+    HCTypeIdentifierArena,
+    HCTypeIdentifierWeakRef,
+    HCTypeIdentifierNumber,
+    HCTypeIdentifierString,
+    HCTypeIdentifierData,
+    HCTypeIdentifierList,
+    HCTypeIdentifierSet,
+    HCTypeIdentifierMap,
+    HCTypeIdentifierPersistentList,
+    HCTypeIdentifierPersistentListNode,
+    HCTypeIdentifierPersistentMap,
+    HCTypeIdentifierPersistentMapNode,
+    HCTypeIdentifierThread,
+    HCTypeIdentifierLock,
+    HCTypeIdentifierCondition,
+    HCTypeIdentifierPath,
+    HCTypeIdentifierRaster,
+} HCTypeIdentifier;
+
+/// Bit representing a type identifier in the @c kindMask of an @c HCTypeData.
+#define HCTypeKindMaskForIdentifier(identifier) ((uint64_t)1 << (identifier))
+
 /// Information related to a type common to all instances of that type.
 /// Includes identifying information for a type and the ancestors of that type.
 typedef const struct HCTypeData {
     HCTypeName name;
     HCType ancestor;
+    /// Numeric identifier of the type, which is unique among types that are not @c HCTypeIdentifierNone.
+    HCTypeIdentifier identifier;
+    /// Bitwise OR of @c HCTypeKindMaskForIdentifier() for the type and each of its ancestors, allowing kind checks without walking ancestors.
+    uint64_t kindMask;
 } HCTypeData;
 
 /// A reference to an instance of an object.
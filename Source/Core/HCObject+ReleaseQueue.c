@@ -0,0 +1,163 @@
+///
+/// @file HCObject+ReleaseQueue.c
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#include "HCObject+ReleaseQueue.h"
+#include "HCObject_Internal.h"
+#include "HCArena_Internal.h"
+#include "../Thread/HCThread.h"
+#include "../Thread/HCCondition.h"
+#include <pthread.h>
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Definitions
+//----------------------------------------------------------------------------------------------------------------------------------
+// NOTE: The release queue is a lock-free stack of objects whose reference counts have reached zero.
+//       Queued objects have no references, so their reference count field is reused to link them without allocating.
+//       Objects are pushed with a compare-and-swap, and the whole stack is taken with a single exchange, so there is no ABA hazard.
+
+/// Most recently queued object, or @c NULL if the release queue is empty.
+static _Atomic(HCObjectRef) HCReleaseQueueHead = NULL;
+/// Whether objects released on the current thread are queued for destruction.
+static _Thread_local HCBoolean HCReleaseQueueDeferred = false;
+
+/// Whether the reclaimer thread is running and should be woken when objects are queued.
+static HCAtomicBoolean HCReleaseQueueReclaiming = false;
+/// The reclaimer thread, or @c NULL if it is not running. Protected by the lock of @c HCReleaseQueueCondition.
+static HCThreadRef HCReleaseQueueReclaimer = NULL;
+/// Condition used to wake the reclaimer thread, which is kept for the lifetime of the process.
+static HCConditionRef HCReleaseQueueCondition = NULL;
+/// The @c pthread_once_t used ensure that @c HCReleaseQueueCondition is only created once.
+static pthread_once_t HCReleaseQueueConditionOnce = PTHREAD_ONCE_INIT;
+
+/// Creates the condition used to wake the reclaimer thread.
+static void HCReleaseQueueSetupCondition(void) {
+    // Create the condition outside of any arena, and share it between threads
+    HCArenaRef previousArena = HCArenaBeginCreatingObjects(NULL);
+    HCReleaseQueueCondition = HCConditionCreate();
+    HCArenaEndCreatingObjects(previousArena);
+    HCObjectMarkShared(HCReleaseQueueCondition);
+}
+
+/// Obtains the condition used to wake the reclaimer thread, creating it if needed.
+/// @returns The condition used to wake the reclaimer thread.
+static HCConditionRef HCReleaseQueueGetCondition(void) {
+    pthread_once(&HCReleaseQueueConditionOnce, HCReleaseQueueSetupCondition);
+    return HCReleaseQueueCondition;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Deferred Release
+//----------------------------------------------------------------------------------------------------------------------------------
+void HCReleaseQueueSetDeferred(HCBoolean deferred) {
+    HCReleaseQueueDeferred = deferred;
+}
+
+HCBoolean HCReleaseQueueIsDeferred(void) {
+    return HCReleaseQueueDeferred;
+}
+
+void HCReleaseQueuePush(HCObjectRef object) {
+    // Link the object to the current head and publish it as the new head
+    HCObjectRef head = atomic_load_explicit(&HCReleaseQueueHead, memory_order_relaxed);
+    do {
+        atomic_store_explicit(&object->referenceCount, (HCInteger)(intptr_t)head, memory_order_relaxed);
+    } while (!atomic_compare_exchange_weak_explicit(&HCReleaseQueueHead, &head, object, memory_order_release, memory_order_relaxed));
+    
+    // Wake the reclaimer thread when the queue becomes non-empty
+    // NOTE: The condition's lock is acquired to signal so the wake cannot be lost between the reclaimer checking the queue and waiting
+    if (head == NULL && atomic_load_explicit(&HCReleaseQueueReclaiming, memory_order_relaxed)) {
+        HCConditionRaiseEventAcquired(HCReleaseQueueGetCondition(), HCConditionEventSignal);
+    }
+}
+
+HCInteger HCDrainReleaseQueue(void) {
+    // Destroy objects released while draining immediately, so draining does not queue more objects
+    HCBoolean deferred = HCReleaseQueueDeferred;
+    HCReleaseQueueDeferred = false;
+    
+    // Take all queued objects and destroy them
+    HCInteger count = 0;
+    HCObjectRef object = atomic_exchange_explicit(&HCReleaseQueueHead, NULL, memory_order_acquire);
+    while (object != NULL) {
+        HCObjectRef next = (HCObjectRef)(intptr_t)atomic_load_explicit(&object->referenceCount, memory_order_relaxed);
+        HCObjectDestroyAndDeallocate(object);
+        object = next;
+        count++;
+    }
+    
+    HCReleaseQueueDeferred = deferred;
+    return count;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Reclaimer Thread
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Entry point of the reclaimer thread, which drains the release queue whenever it is non-empty until the thread is cancelled.
+/// @param context Unused.
+static void HCReleaseQueueReclaim(void* context) {
+    (void)context; // Unused
+    HCConditionRef condition = HCReleaseQueueGetCondition();
+    HCThreadRef thread = HCThreadGetCurrent();
+    HCConditionAquire(condition);
+    while (!HCThreadIsCancelled(thread)) {
+        // Wait for objects to be queued, checking the queue with the lock acquired so a wake cannot be missed
+        if (atomic_load_explicit(&HCReleaseQueueHead, memory_order_relaxed) == NULL) {
+            HCConditionWait(condition);
+            continue;
+        }
+        
+        // Destroy queued objects without holding the lock, so releasing threads are not blocked
+        HCConditionRelinquish(condition);
+        HCDrainReleaseQueue();
+        HCConditionAquire(condition);
+    }
+    HCConditionRelinquish(condition);
+}
+
+void HCReleaseQueueStartReclaimer(void) {
+    HCConditionRef condition = HCReleaseQueueGetCondition();
+    HCConditionAquire(condition);
+    if (HCReleaseQueueReclaimer == NULL) {
+        // Create the thread outside of any arena, and share it between threads
+        HCArenaRef previousArena = HCArenaBeginCreatingObjects(NULL);
+        HCReleaseQueueReclaimer = HCThreadCreate(HCReleaseQueueReclaim, NULL);
+        HCArenaEndCreatingObjects(previousArena);
+        HCObjectMarkShared(HCReleaseQueueReclaimer);
+        atomic_store(&HCReleaseQueueReclaiming, true);
+        HCThreadExecute(HCReleaseQueueReclaimer);
+    }
+    HCConditionRelinquish(condition);
+}
+
+void HCReleaseQueueStopReclaimer(void) {
+    // Take the reclaimer thread and wake it so it observes its cancellation
+    HCConditionRef condition = HCReleaseQueueGetCondition();
+    HCConditionAquire(condition);
+    HCThreadRef reclaimer = HCReleaseQueueReclaimer;
+    HCReleaseQueueReclaimer = NULL;
+    if (reclaimer != NULL) {
+        atomic_store(&HCReleaseQueueReclaiming, false);
+        HCThreadCancel(reclaimer);
+        HCConditionSignal(condition);
+    }
+    HCConditionRelinquish(condition);
+    if (reclaimer == NULL) {
+        return;
+    }
+    
+    // Wait for the reclaimer thread to finish, then destroy anything it left behind
+    HCThreadJoin(reclaimer);
+    HCRelease(reclaimer);
+    HCDrainReleaseQueue();
+}
+
+HCBoolean HCReleaseQueueIsReclaiming(void) {
+    return atomic_load(&HCReleaseQueueReclaiming);
+}
@@ -0,0 +1,61 @@
+///
+/// @file HCObject+ReleaseQueue.h
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+/// @brief Deferred destruction of released objects.
+///
+
+#ifndef HCObject_ReleaseQueue_h
+#define HCObject_ReleaseQueue_h
+
+#include "HCObject.h"
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Deferred Release
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Sets whether objects released on the calling thread are destroyed immediately or queued for destruction.
+///
+/// When deferred, an object whose last reference is released on the calling thread is added to the release queue rather than destroyed, so the cost of destroying large object graphs is moved off the calling thread.
+/// Queued objects are destroyed by the reclaimer thread started with @c HCReleaseQueueStartReclaimer(), or by calling @c HCDrainReleaseQueue().
+/// Thread-confined objects are never queued, and are destroyed immediately on the calling thread, since only it may release the references they hold.
+///
+/// @param deferred @c true if objects released on the calling thread should be queued for destruction, or @c false if they should be destroyed immediately.
+void HCReleaseQueueSetDeferred(HCBoolean deferred);
+
+/// Determines if objects released on the calling thread are queued for destruction.
+/// @returns @c true if objects released on the calling thread are queued for destruction, or @c false if they are destroyed immediately.
+HCBoolean HCReleaseQueueIsDeferred(void);
+
+/// Destroys the objects in the release queue on the calling thread.
+///
+/// Objects queued by other threads while draining are left for a later drain.
+/// Objects released while destroying queued objects are destroyed immediately, even if the calling thread defers destruction.
+///
+/// @returns The number of queued objects that were destroyed.
+HCInteger HCDrainReleaseQueue(void);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Reclaimer Thread
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Starts a background thread that destroys objects as they are added to the release queue.
+///
+/// Has no effect if the reclaimer thread is already running.
+void HCReleaseQueueStartReclaimer(void);
+
+/// Stops the background thread started by @c HCReleaseQueueStartReclaimer(), blocking until it has finished.
+///
+/// Objects remaining in the release queue are destroyed on the calling thread before returning.
+/// Has no effect if the reclaimer thread is not running.
+void HCReleaseQueueStopReclaimer(void);
+
+/// Determines if the background thread started by @c HCReleaseQueueStartReclaimer() is running.
+/// @returns @c true if the reclaimer thread is running, or @c false otherwise.
+HCBoolean HCReleaseQueueIsReclaiming(void);
+
+#endif /* HCObject_ReleaseQueue_h */
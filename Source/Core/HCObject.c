@@ -8,26 +8,61 @@
 ///
 
 #include "../Core/HCObject_Internal.h"
+#include "../Core/HCAllocator_Internal.h"
+#include "../Core/HCArena_Internal.h"
+#include "../Core/HCObject+ReleaseQueue.h"
+#include "../Core/HCWeakRef_Internal.h"
+#include "../Data/HCNumber.h"
 #include <string.h>
+#include <assert.h>
 
 /// If the decrement of the reference count returns this value the object will be destroyed.
 ///
 /// - Note: This value is not @c 0 because atomic decrements return the previous value.
 const static HCInteger HCObjectReferenceCountDestructionValue = 1;
 
+/// Number of objects whose destruction is grouped by type when releasing an array of objects.
+#define HCObjectArrayDestroyBatchCountStatic (64)
+/// Number of elements ahead of the current element that are prefetched when retaining or releasing an array of objects.
+#define HCObjectArrayPrefetchDistanceStatic (8)
+
+/// Source of the identifiers of threads that confine objects.
+static atomic_uint_least32_t HCObjectThreadIdentifierCounter = HCObjectConfinedThreadNoneStatic;
+/// The identifier of the current thread used to confine objects, or @c HCObjectConfinedThreadNoneStatic if not yet assigned.
+static _Thread_local uint32_t HCObjectThreadIdentifier = HCObjectConfinedThreadNoneStatic;
+/// Whether objects created on the current thread are confined to it.
+static _Thread_local HCBoolean HCObjectCreatesThreadConfined = false;
+
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Object Type Query
 //----------------------------------------------------------------------------------------------------------------------------------
 HCBoolean HCTypeIsOfType(HCType type, HCType other) {
-    return (type != NULL && other != NULL) && (type == other || strcmp(type->name, other->name) == 0);
+    // Reject type checks against the null type
+    if (type == NULL || other == NULL) {
+        return false;
+    }
+    
+    // Compare identifiers when both types have them, and otherwise compare names so types are matched across library instances
+    if (type == other) {
+        return true;
+    }
+    if (type->identifier != HCTypeIdentifierNone && other->identifier != HCTypeIdentifierNone) {
+        return type->identifier == other->identifier;
+    }
+    return strcmp(type->name, other->name) == 0;
 }
 
 HCBoolean HCTypeHasAncestor(HCType type, HCType other) {
     // Reject type checks against the null type
-    if (type == NULL) {
+    if (type == NULL || other == NULL) {
         return false;
     }
     
+    // Check the kind mask when both types have identifiers
+    if (type->identifier != HCTypeIdentifierNone && other->identifier != HCTypeIdentifierNone) {
+        return type->identifier != other->identifier && (type->kindMask & HCTypeKindMaskForIdentifier(other->identifier)) != 0;
+    }
+    
     // Determine if the type or that of any of its ancestors are of the given type
     for (HCType ancestor = type->ancestor; ancestor != NULL; ancestor = ancestor->ancestor) {
         if (HCTypeIsOfType(ancestor, other)) {
@@ -38,31 +73,36 @@ HCBoolean HCTypeHasAncestor(HCType type, HCType other) {
 }
 
 HCBoolean HCTypeIsOfKind(HCType type, HCType other) {
+    // Check the kind mask when both types have identifiers
+    if (type != NULL && other != NULL && type->identifier != HCTypeIdentifierNone && other->identifier != HCTypeIdentifierNone) {
+        return (type->kindMask & HCTypeKindMaskForIdentifier(other->identifier)) != 0;
+    }
     return HCTypeIsOfType(type, other) || HCTypeHasAncestor(type, other);
 }
 
 HCType HCObjectTypeOf(HCRef object) {
-    return ((HCObjectRef)object)->type;
+    // NOTE: Tagged pointers are only used for number values
+    return HCObjectTagOf(object) != HCObjectTagNone ? HCNumberType : ((HCObjectRef)object)->type;
 }
 
 HCTypeName HCObjectTypeName(HCRef object) {
-    return ((HCObjectRef)object)->type->name;
+    return HCObjectTypeOf(object)->name;
 }
 
 HCType HCObjectTypeAncestor(HCRef object) {
-    return ((HCObjectRef)object)->type->ancestor;
+    return HCObjectTypeOf(object)->ancestor;
 }
 
 HCBoolean HCObjectHasAncestor(HCRef object, HCType type) {
-    return object != NULL && HCTypeHasAncestor(((HCObjectRef)object)->type, type);
+    return object != NULL && HCTypeHasAncestor(HCObjectTypeOf(object), type);
 }
 
 HCBoolean HCObjectIsOfType(HCRef object, HCType type) {
-    return object != NULL && HCTypeIsOfType(((HCObjectRef)object)->type, type);
+    return object != NULL && HCTypeIsOfType(HCObjectTypeOf(object), type);
 }
 
 HCBoolean HCObjectIsOfKind(HCRef object, HCType type) {
-    return object != NULL && HCTypeIsOfKind(((HCObjectRef)object)->type, type);
+    return object != NULL && HCTypeIsOfKind(HCObjectTypeOf(object), type);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -85,31 +125,263 @@ HCBoolean HCObjectIsOfKind(HCRef object, HCType type) {
 //  After the subtraction there is a fence using memory_order_acquire to ensure that the destruction of the object and all other accesses to it are performed afterwards.
 //  We also get the benefit of seperating out this fence from the subtration operation to get substation performance benefits on some platforms.
 
+//  Thread-confined objects are only retained and released by one thread, so their reference count is updated with relaxed loads and stores rather than read-modify-write operations.
+//  This is similar to the biased reference counting Swift uses for objects owned by a thread, without the separate shared count.
+
+/// Obtains the identifier of the current thread used to confine objects, assigning one if needed.
+/// @returns An identifier unique to the current thread that is not @c HCObjectConfinedThreadNoneStatic.
+static uint32_t HCObjectCurrentThreadIdentifier(void) {
+    if (HCObjectThreadIdentifier == HCObjectConfinedThreadNoneStatic) {
+        HCObjectThreadIdentifier = atomic_fetch_add_explicit(&HCObjectThreadIdentifierCounter, 1, memory_order_relaxed) + 1;
+    }
+    return HCObjectThreadIdentifier;
+}
+
+/// Clears the weak references to an object, so they can no longer be loaded once it starts being destroyed.
+/// @param self The object whose reference count has reached zero or that is being destroyed.
+static void HCObjectClearWeakReferences(HCObjectRef self) {
+    if ((atomic_load_explicit(&self->flags, memory_order_relaxed) & HCObjectFlagWeaklyReferenced) != 0) {
+        HCWeakRefClearObject(self);
+    }
+}
+
+/// Destroys an object whose reference count has reached zero, or adds it to the release queue if the current thread defers destruction.
+/// Thread-confined objects are always destroyed immediately, since destroying them releases references confined to the current thread.
+/// @param self The object whose reference count has reached zero.
+static void HCObjectReleased(HCObjectRef self) {
+    HCObjectClearWeakReferences(self);
+    if (HCReleaseQueueIsDeferred() && self->confinedThread == HCObjectConfinedThreadNoneStatic) {
+        HCReleaseQueuePush(self);
+    }
+    else {
+        HCObjectDestroyAndDeallocate(self);
+    }
+}
+
 HCRef HCRetain(HCRef self) {
-    // Retain on the null reference is a no-op
-    if (self == NULL) {
-        return NULL;
+    // Retain on the null reference, tagged pointers, and immortal objects is a no-op
+    if (self == NULL || HCObjectTagOf(self) != HCObjectTagNone) {
+        return self;
+    }
+    HCObjectRef object = self;
+    HCInteger referenceCount = atomic_load_explicit(&object->referenceCount, memory_order_relaxed);
+    if (referenceCount == HCObjectReferenceCountImmortalStatic) {
+        return self;
+    }
+    
+    // Increment the reference count of thread-confined objects without an atomic read-modify-write
+    if (object->confinedThread != HCObjectConfinedThreadNoneStatic) {
+        assert(object->confinedThread == HCObjectCurrentThreadIdentifier() && "Thread-confined object retained on another thread");
+        atomic_store_explicit(&object->referenceCount, referenceCount + 1, memory_order_relaxed);
+        return self;
     }
 
     // For atomic memory ordering description see the notes at the top of this section.
-    atomic_fetch_add_explicit(&((HCObjectRef)self)->referenceCount, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&object->referenceCount, 1, memory_order_relaxed);
     return self;
 }
 
 void HCRelease(HCRef self) {
-    // Release on the null reference is a no-op
-    if (self == NULL) {
+    // Release on the null reference, tagged pointers, and immortal objects is a no-op
+    if (self == NULL || HCObjectTagOf(self) != HCObjectTagNone) {
+        return;
+    }
+    HCObjectRef object = self;
+    HCInteger referenceCount = atomic_load_explicit(&object->referenceCount, memory_order_relaxed);
+    if (referenceCount == HCObjectReferenceCountImmortalStatic) {
+        return;
+    }
+    
+    // Decrement the reference count of thread-confined objects without an atomic read-modify-write or fence
+    if (object->confinedThread != HCObjectConfinedThreadNoneStatic) {
+        assert(object->confinedThread == HCObjectCurrentThreadIdentifier() && "Thread-confined object released on another thread");
+        atomic_store_explicit(&object->referenceCount, referenceCount - 1, memory_order_relaxed);
+        if (referenceCount == HCObjectReferenceCountDestructionValue) {
+            HCObjectReleased(object);
+        }
         return;
     }
 
     // For atomic memory ordering description see the notes at the top of this section.
-    if (atomic_fetch_sub_explicit(&((HCObjectRef)self)->referenceCount, 1, memory_order_release) == HCObjectReferenceCountDestructionValue) {
+    if (atomic_fetch_sub_explicit(&object->referenceCount, 1, memory_order_release) == HCObjectReferenceCountDestructionValue) {
         atomic_thread_fence(memory_order_acquire);
-        for (HCType type = ((HCObjectRef)self)->type; type != NULL; type = type->ancestor) {
-            ((HCObjectTypeData*)type)->destroy(self);
+        HCObjectReleased(object);
+    }
+}
+
+/// Determines the number of consecutive elements of an array that are the same reference, prefetching the objects that follow.
+/// @param objects The array of objects.
+/// @param count The number of elements in @c objects.
+/// @param index The index of the first element of the run.
+/// @param prefetchIndex The index of the next element to prefetch, which is advanced past the prefetched elements.
+/// @returns The number of consecutive elements starting at @c index that are equal to @c objects[index].
+static HCInteger HCObjectArrayRunLength(HCRef* objects, HCInteger count, HCInteger index, HCInteger* prefetchIndex) {
+    // Prefetch objects ahead of the run so their reference counts are in cache when they are reached
+    // NOTE: Prefetching never faults, so null and tagged references need not be skipped
+#if defined(__GNUC__) || defined(__clang__)
+    for (; *prefetchIndex < count && *prefetchIndex < index + HCObjectArrayPrefetchDistanceStatic; (*prefetchIndex)++) {
+        __builtin_prefetch(objects[*prefetchIndex], 1);
+    }
+#else
+    (void)prefetchIndex; // Unused
+#endif
+    
+    // Count repetitions of the reference at the start of the run
+    HCInteger runLength = 1;
+    while (index + runLength < count && objects[index + runLength] == objects[index]) {
+        runLength++;
+    }
+    return runLength;
+}
+
+/// Destroys and deallocates objects whose reference counts have reached zero, grouped by type.
+/// @param objects The objects to destroy. Elements are set to @c NULL as they are destroyed.
+/// @param count The number of elements in @c objects.
+static void HCObjectDestroyAndDeallocateArray(HCObjectRef* objects, HCInteger count) {
+    // Pair one acquire fence with the release decrements of all the objects
+    atomic_thread_fence(memory_order_acquire);
+    
+    // Queue shared objects if the current thread defers destruction, leaving thread-confined objects to be destroyed on this thread
+    if (HCReleaseQueueIsDeferred()) {
+        for (HCInteger index = 0; index < count; index++) {
+            if (objects[index]->confinedThread == HCObjectConfinedThreadNoneStatic) {
+                HCReleaseQueuePush(objects[index]);
+                objects[index] = NULL;
+            }
         }
-        free(self);
     }
+    
+    // Destroy objects of the same type together so their destroy functions run consecutively
+    for (HCInteger index = 0; index < count; index++) {
+        if (objects[index] == NULL) {
+            continue;
+        }
+        HCType type = objects[index]->type;
+        for (HCInteger typeIndex = index; typeIndex < count; typeIndex++) {
+            if (objects[typeIndex] != NULL && objects[typeIndex]->type == type) {
+                HCObjectDestroyAndDeallocate(objects[typeIndex]);
+                objects[typeIndex] = NULL;
+            }
+        }
+    }
+}
+
+void HCRetainArray(HCRef* objects, HCInteger count) {
+    HCInteger prefetchIndex = 0;
+    for (HCInteger index = 0, runLength = 0; index < count; index += runLength) {
+        runLength = HCObjectArrayRunLength(objects, count, index, &prefetchIndex);
+        
+        // Retain on the null reference, tagged pointers, and immortal objects is a no-op
+        HCObjectRef object = objects[index];
+        if (object == NULL || HCObjectTagOf(object) != HCObjectTagNone) {
+            continue;
+        }
+        HCInteger referenceCount = atomic_load_explicit(&object->referenceCount, memory_order_relaxed);
+        if (referenceCount == HCObjectReferenceCountImmortalStatic) {
+            continue;
+        }
+        
+        // Increment the reference count once for the whole run
+        if (object->confinedThread != HCObjectConfinedThreadNoneStatic) {
+            assert(object->confinedThread == HCObjectCurrentThreadIdentifier() && "Thread-confined object retained on another thread");
+            atomic_store_explicit(&object->referenceCount, referenceCount + runLength, memory_order_relaxed);
+        }
+        else {
+            atomic_fetch_add_explicit(&object->referenceCount, runLength, memory_order_relaxed);
+        }
+    }
+}
+
+void HCReleaseArray(HCRef* objects, HCInteger count) {
+    HCObjectRef destroyed[HCObjectArrayDestroyBatchCountStatic];
+    HCInteger destroyedCount = 0;
+    HCInteger prefetchIndex = 0;
+    for (HCInteger index = 0, runLength = 0; index < count; index += runLength) {
+        runLength = HCObjectArrayRunLength(objects, count, index, &prefetchIndex);
+        
+        // Release on the null reference, tagged pointers, and immortal objects is a no-op
+        HCObjectRef object = objects[index];
+        if (object == NULL || HCObjectTagOf(object) != HCObjectTagNone) {
+            continue;
+        }
+        HCInteger referenceCount = atomic_load_explicit(&object->referenceCount, memory_order_relaxed);
+        if (referenceCount == HCObjectReferenceCountImmortalStatic) {
+            continue;
+        }
+        
+        // Decrement the reference count once for the whole run
+        HCBoolean released = false;
+        if (object->confinedThread != HCObjectConfinedThreadNoneStatic) {
+            assert(object->confinedThread == HCObjectCurrentThreadIdentifier() && "Thread-confined object released on another thread");
+            atomic_store_explicit(&object->referenceCount, referenceCount - runLength, memory_order_relaxed);
+            released = referenceCount == runLength;
+        }
+        else {
+            released = atomic_fetch_sub_explicit(&object->referenceCount, runLength, memory_order_release) == runLength;
+        }
+        
+        // Collect released objects to be destroyed in batches
+        if (released) {
+            HCObjectClearWeakReferences(object);
+            destroyed[destroyedCount++] = object;
+            if (destroyedCount == HCObjectArrayDestroyBatchCountStatic) {
+                HCObjectDestroyAndDeallocateArray(destroyed, destroyedCount);
+                destroyedCount = 0;
+            }
+        }
+    }
+    HCObjectDestroyAndDeallocateArray(destroyed, destroyedCount);
+}
+
+HCBoolean HCObjectRetainIfReferenced(HCObjectRef self) {
+    // Retain the object only if its reference count has not reached zero, so objects being destroyed are not resurrected
+    HCInteger referenceCount = atomic_load_explicit(&self->referenceCount, memory_order_relaxed);
+    if (referenceCount == HCObjectReferenceCountImmortalStatic) {
+        return true;
+    }
+    if (self->confinedThread != HCObjectConfinedThreadNoneStatic) {
+        assert(self->confinedThread == HCObjectCurrentThreadIdentifier() && "Thread-confined object retained on another thread");
+        if (referenceCount == 0) {
+            return false;
+        }
+        atomic_store_explicit(&self->referenceCount, referenceCount + 1, memory_order_relaxed);
+        return true;
+    }
+    while (referenceCount != 0) {
+        if (atomic_compare_exchange_weak_explicit(&self->referenceCount, &referenceCount, referenceCount + 1, memory_order_relaxed, memory_order_relaxed)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void HCObjectMarkThreadConfined(HCRef self) {
+    // Marking the null reference, tagged pointers, and immortal objects is a no-op, since immortal objects may be used by all threads
+    if (self == NULL || HCObjectTagOf(self) != HCObjectTagNone || atomic_load_explicit(&((HCObjectRef)self)->referenceCount, memory_order_relaxed) == HCObjectReferenceCountImmortalStatic) {
+        return;
+    }
+    ((HCObjectRef)self)->confinedThread = HCObjectCurrentThreadIdentifier();
+}
+
+void HCObjectMarkShared(HCRef self) {
+    if (self == NULL || HCObjectTagOf(self) != HCObjectTagNone || atomic_load_explicit(&((HCObjectRef)self)->referenceCount, memory_order_relaxed) == HCObjectReferenceCountImmortalStatic) {
+        return;
+    }
+    assert((((HCObjectRef)self)->confinedThread == HCObjectConfinedThreadNoneStatic || ((HCObjectRef)self)->confinedThread == HCObjectCurrentThreadIdentifier()) && "Thread-confined object shared on another thread");
+    ((HCObjectRef)self)->confinedThread = HCObjectConfinedThreadNoneStatic;
+}
+
+HCBoolean HCObjectIsThreadConfined(HCRef self) {
+    return self != NULL && HCObjectTagOf(self) == HCObjectTagNone && ((HCObjectRef)self)->confinedThread != HCObjectConfinedThreadNoneStatic;
+}
+
+HCRef HCObjectCreateThreadConfined(HCObjectCreateFunction function, void* context) {
+    // Confine objects created by the function, restoring the previous state afterwards so calls may be nested
+    HCBoolean previous = HCObjectCreatesThreadConfined;
+    HCObjectCreatesThreadConfined = true;
+    HCRef object = function(context);
+    HCObjectCreatesThreadConfined = previous;
+    return object;
 }
 
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -117,15 +389,23 @@ void HCRelease(HCRef self) {
 //----------------------------------------------------------------------------------------------------------------------------------
 HCBoolean HCIsEqual(HCRef self, HCRef other) {
 //    TODO: Find the highest common ancestor to perform the equality check
-    return self != NULL && other != NULL && ((HCObjectTypeData*)((HCObjectRef)self)->type)->isEqual(self, other);
+    if (self == NULL || other == NULL) {
+        return false;
+    }
+    
+    // Tagged pointers are only equal to other numbers, so they are never passed to the equality function of another type
+    if ((HCObjectTagOf(self) != HCObjectTagNone || HCObjectTagOf(other) != HCObjectTagNone) && !(HCObjectIsOfType(self, HCNumberType) && HCObjectIsOfType(other, HCNumberType))) {
+        return false;
+    }
+    return ((HCObjectTypeData*)HCObjectTypeOf(self))->isEqual(self, other);
 }
 
 HCInteger HCHashValue(HCRef self) {
-    return self == NULL ? 0 : ((HCObjectTypeData*)((HCObjectRef)self)->type)->hashValue(self);
+    return self == NULL ? 0 : ((HCObjectTypeData*)HCObjectTypeOf(self))->hashValue(self);
 }
 
 void HCPrint(HCRef self, FILE* stream) {
-    ((HCObjectTypeData*)((HCObjectRef)self)->type)->print(self, stream);
+    ((HCObjectTypeData*)HCObjectTypeOf(self))->print(self, stream);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -135,6 +415,8 @@ HCObjectTypeData HCObjectTypeDataInstance = {
     .base = {
         .ancestor = NULL,
         .name = "HCObject",
+        .identifier = HCTypeIdentifierObject,
+        .kindMask = HCTypeKindMaskForIdentifier(HCTypeIdentifierObject),
     },
     .isEqual = (void*)HCObjectIsEqual,
     .hashValue = (void*)HCObjectHashValue,
@@ -147,13 +429,18 @@ HCType HCObjectType = &HCObjectTypeDataInstance.base;
 // MARK: - Construction
 //----------------------------------------------------------------------------------------------------------------------------------
 void HCObjectInit(void* memory) {
+    // Make objects allocated in an arena immortal, using the size class recorded when the object was allocated
+    // NOTE: Objects not allocated by HCObjectAllocate(), such as strings borrowing stack memory, must be zeroed before initialization
     HCObjectRef self = memory;
     self->type = HCObjectType;
-    self->referenceCount = 1;
+    self->referenceCount = self->sizeClass == HCObjectSizeClassArenaStatic ? HCObjectReferenceCountImmortalStatic : 1;
+    self->flags = 0;
+    self->confinedThread = HCObjectCreatesThreadConfined && self->referenceCount != HCObjectReferenceCountImmortalStatic ? HCObjectCurrentThreadIdentifier() : HCObjectConfinedThreadNoneStatic;
 }
 
 void HCObjectDestroy(HCObjectRef self) {
-    (void)self; // Unused
+    // Clear weak references to objects destroyed without being released, such as those in an arena
+    HCObjectClearWeakReferences(self);
 }
 
 void HCObjectSetType(void* object, HCType type) {
@@ -161,6 +448,45 @@ void HCObjectSetType(void* object, HCType type) {
     self->type = type;
 }
 
+void HCObjectDestroyAndDeallocate(HCObjectRef self) {
+    // Destroy the object from its type up through its ancestors, then return its memory
+    for (HCType type = self->type; type != NULL; type = type->ancestor) {
+        ((HCObjectTypeData*)type)->destroy(self);
+    }
+    HCObjectDeallocate(self);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Allocation
+//----------------------------------------------------------------------------------------------------------------------------------
+void* HCObjectAllocate(HCInteger size) {
+    // Allocate in the arena objects are being created in on this thread, if any
+    HCArenaRef arena = HCArenaGetCurrent();
+    if (arena != NULL) {
+        return HCArenaAllocateObject(arena, size);
+    }
+    
+    // Allocate zeroed memory for an object from the slab of its size class, or from the C library if it is too large
+    // NOTE: The size class is recorded in the object so it can be deallocated without knowing its size, and is preserved by HCObjectInit()
+    HCInteger sizeClass = HCAllocatorSizeClassForSize(size);
+    HCObjectRef self = sizeClass == HCAllocatorSizeClassNoneStatic ? calloc(size, 1) : HCAllocatorAllocate(sizeClass);
+    if (self == NULL) {
+        return NULL;
+    }
+    self->sizeClass = (uint16_t)sizeClass;
+    return self;
+}
+
+void HCObjectDeallocate(HCRef object) {
+    HCObjectRef self = object;
+    if (self->sizeClass == HCAllocatorSizeClassNoneStatic) {
+        free(self);
+    }
+    else {
+        HCAllocatorDeallocate(self, self->sizeClass);
+    }
+}
+
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Object Polymorphic Functions
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -173,5 +499,5 @@ HCInteger HCObjectHashValue(HCObjectRef self) {
 }
 
 void HCObjectPrint(HCObjectRef self, FILE* stream) {
-    fprintf(stream, "<%s@%p>", self->type->name, self);
+    fprintf(stream, "<%s@%p>", HCObjectTypeName(self), self);
 }
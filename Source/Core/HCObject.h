@@ -119,6 +119,58 @@ HCRef HCRetain(HCRef self);
 /// @param self The object whose reference count should be decremented.
 void HCRelease(HCRef self);
 
+/// Increments the reference count of each object instance in an array.
+///
+/// Functions as if @c HCRetain() were called on each element of @c objects, but adjusts the reference count of an object repeated in consecutive elements once.
+///
+/// @param objects The objects whose reference counts should be increased. May contain @c NULL references.
+/// @param count The number of elements in @c objects.
+void HCRetainArray(HCRef* objects, HCInteger count);
+
+/// Decrements the reference count of each object instance in an array.
+///
+/// Functions as if @c HCRelease() were called on each element of @c objects, but adjusts the reference count of an object repeated in consecutive elements once.
+/// Objects whose reference counts reach zero are destroyed in groups of the same type after their reference counts have been decremented.
+///
+/// @param objects The objects whose reference counts should be decremented. May contain @c NULL references.
+/// @param count The number of elements in @c objects.
+void HCReleaseArray(HCRef* objects, HCInteger count);
+
+/// Function that creates objects using @c HCObjectCreateThreadConfined().
+/// @param context The context value passed to @c HCObjectCreateThreadConfined().
+/// @returns The object to be returned from @c HCObjectCreateThreadConfined().
+typedef HCRef (*HCObjectCreateFunction)(void* context);
+
+/// Confines an object to the calling thread.
+///
+/// The reference count of a thread-confined object is changed without atomic operations, so @c HCRetain() and @c HCRelease() are cheaper.
+/// A thread-confined object must only be retained and released on the thread that confined it until @c HCObjectMarkShared() is called.
+/// When assertions are enabled, retaining or releasing a thread-confined object on another thread fails an assertion.
+///
+/// @param self The object to confine to the calling thread. Immortal objects, such as those in an arena, may be used by all threads and are never confined.
+void HCObjectMarkThreadConfined(HCRef self);
+
+/// Allows an object to be retained and released on any thread.
+///
+/// Must be called on the thread the object is confined to before the object is passed to another thread.
+///
+/// @param self The object to share between threads.
+void HCObjectMarkShared(HCRef self);
+
+/// Determines if an object is confined to a thread.
+/// @param self The object to examine.
+/// @returns @c true if the object was confined to a thread by @c HCObjectMarkThreadConfined() or @c HCObjectCreateThreadConfined() and has not since been shared.
+HCBoolean HCObjectIsThreadConfined(HCRef self);
+
+/// Creates objects that are confined to the calling thread.
+///
+/// Every object created on the calling thread while @c function is executing is confined to the calling thread as if @c HCObjectMarkThreadConfined() were called on it.
+///
+/// @param function The function that creates the objects.
+/// @param context A context value passed to @c function.
+/// @returns The object returned by @c function.
+HCRef HCObjectCreateThreadConfined(HCObjectCreateFunction function, void* context);
+
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Object Polymorphic Functions
 //----------------------------------------------------------------------------------------------------------------------------------
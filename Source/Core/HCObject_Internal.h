@@ -19,6 +19,58 @@
 typedef _Atomic HCBoolean HCAtomicBoolean;
 typedef _Atomic HCInteger HCAtomicInteger;
 
+/// Reference count of objects that are never destroyed, for which retain and release are no-ops.
+#define HCObjectReferenceCountImmortalStatic (INT64_MAX)
+
+/// Size class of objects allocated in an arena, which are immortal until the arena is destroyed.
+#define HCObjectSizeClassArenaStatic (UINT16_MAX)
+
+/// Confining thread of objects that may be retained and released on any thread.
+#define HCObjectConfinedThreadNoneStatic (0)
+
+/// Flags recording optional state of an object.
+typedef enum HCObjectFlag {
+    /// The object is referenced by an @c HCWeakRef in the weak reference side table.
+    HCObjectFlagWeaklyReferenced = 0b1,
+} HCObjectFlag;
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Tagged Pointers
+//----------------------------------------------------------------------------------------------------------------------------------
+// NOTE: Object allocations are at least 4-byte aligned, so references with either of the low two bits set are immediate values
+//       encoded in the reference itself. Tagged references are never dereferenced, retained, or released.
+//       Tagged pointers require 64-bit references so tagged integers have a useful range, and can be disabled by defining
+//       HCObjectTaggedPointersDisabled, in which case HCNumber falls back to immortal singletons for common values.
+#if UINTPTR_MAX == UINT64_MAX && !defined(HCObjectTaggedPointersDisabled)
+#define HCObjectTaggedPointersStatic (1)
+#else
+#define HCObjectTaggedPointersStatic (0)
+#endif
+
+#define HCObjectTagMaskStatic ((uintptr_t)0b11)
+#define HCObjectTagShiftStatic (2)
+#define HCObjectTaggedIntegerMinimumStatic (-((HCInteger)1 << 61))
+#define HCObjectTaggedIntegerMaximumStatic (((HCInteger)1 << 61) - 1)
+
+typedef enum HCObjectTag {
+    HCObjectTagNone = 0b00,
+    HCObjectTagInteger = 0b01,
+    HCObjectTagBoolean = 0b10,
+} HCObjectTag;
+
+static inline HCObjectTag HCObjectTagOf(HCRef object) {
+    return HCObjectTaggedPointersStatic ? (HCObjectTag)((uintptr_t)object & HCObjectTagMaskStatic) : HCObjectTagNone;
+}
+
+static inline HCRef HCObjectTaggedPointerCreate(HCObjectTag tag, HCInteger payload) {
+    return (HCRef)(((uintptr_t)payload << HCObjectTagShiftStatic) | (uintptr_t)tag);
+}
+
+static inline HCInteger HCObjectTaggedPointerPayload(HCRef object) {
+    // NOTE: Right shift of the signed reference value sign-extends the payload
+    return (HCInteger)((intptr_t)object >> HCObjectTagShiftStatic);
+}
+
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Object Type
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -30,6 +82,9 @@ extern HCObjectTypeData HCObjectTypeDataInstance;
 typedef struct HCObject {
     HCType type;
     HCAtomicInteger referenceCount;
+    uint16_t sizeClass;
+    _Atomic uint16_t flags;
+    uint32_t confinedThread;
 } HCObject;
 
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -39,5 +94,18 @@ void HCObjectInit(void* memory);
 void HCObjectDestroy(HCObjectRef self);
 
 void HCObjectSetType(void* object, HCType type);
+void HCObjectDestroyAndDeallocate(HCObjectRef self);
+HCBoolean HCObjectRetainIfReferenced(HCObjectRef self);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Allocation
+//----------------------------------------------------------------------------------------------------------------------------------
+void* HCObjectAllocate(HCInteger size);
+void HCObjectDeallocate(HCRef object);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Deferred Release
+//----------------------------------------------------------------------------------------------------------------------------------
+void HCReleaseQueuePush(HCObjectRef object);
 
 #endif /* HCObject_Internal_h */
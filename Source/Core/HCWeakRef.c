@@ -0,0 +1,199 @@
+///
+/// @file HCWeakRef.c
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#include "HCWeakRef_Internal.h"
+#include "HCArena_Internal.h"
+#include <pthread.h>
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Type
+//----------------------------------------------------------------------------------------------------------------------------------
+const HCObjectTypeData HCWeakRefTypeDataInstance = {
+    .base = {
+        .ancestor = &HCObjectTypeDataInstance.base,
+        .name = "HCWeakRef",
+        .identifier = HCTypeIdentifierWeakRef,
+        .kindMask = HCTypeKindMaskForIdentifier(HCTypeIdentifierObject) | HCTypeKindMaskForIdentifier(HCTypeIdentifierWeakRef),
+    },
+    .isEqual = (void*)HCWeakRefIsEqual,
+    .hashValue = (void*)HCWeakRefHashValue,
+    .print = (void*)HCWeakRefPrint,
+    .destroy = (void*)HCWeakRefDestroy,
+};
+HCType HCWeakRefType = (HCType)&HCWeakRefTypeDataInstance;
+
+/// Lock protecting the side table and the objects of the weak references in it.
+static pthread_mutex_t HCWeakRefTableLock = PTHREAD_MUTEX_INITIALIZER;
+/// Chains of the weak references in the side table, indexed by the address of their objects.
+static HCWeakRefRef* HCWeakRefTableBuckets = NULL;
+/// Number of chains in the side table, which is zero or a power of two.
+static HCInteger HCWeakRefTableCapacity = 0;
+/// Number of weak references in the side table.
+static HCInteger HCWeakRefTableCount = 0;
+
+/// Determines the chain of the side table that contains weak references to an object.
+/// @param object The weakly referenced object.
+/// @param capacity The number of chains in the side table.
+/// @returns The index of the chain.
+static HCInteger HCWeakRefTableBucketIndex(HCRef object, HCInteger capacity) {
+    // NOTE: The low bits of object addresses are mostly zero due to alignment, so the address is mixed before masking
+    uint64_t hash = (uint64_t)(uintptr_t)object * 0x9E3779B97F4A7C15;
+    return (HCInteger)(hash >> 32) & (capacity - 1);
+}
+
+/// Doubles the number of chains in the side table, redistributing the weak references in it.
+static void HCWeakRefTableGrow(void) {
+    HCInteger capacity = HCWeakRefTableCapacity == 0 ? HCWeakRefTableMinimumCapacityStatic : HCWeakRefTableCapacity * 2;
+    HCWeakRefRef* buckets = calloc(capacity, sizeof(HCWeakRefRef));
+    // TODO: Failable
+    for (HCInteger bucketIndex = 0; bucketIndex < HCWeakRefTableCapacity; bucketIndex++) {
+        HCWeakRefRef entry = HCWeakRefTableBuckets[bucketIndex];
+        while (entry != NULL) {
+            HCWeakRefRef next = entry->next;
+            HCInteger index = HCWeakRefTableBucketIndex(entry->object, capacity);
+            entry->next = buckets[index];
+            buckets[index] = entry;
+            entry = next;
+        }
+    }
+    free(HCWeakRefTableBuckets);
+    HCWeakRefTableBuckets = buckets;
+    HCWeakRefTableCapacity = capacity;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Construction
+//----------------------------------------------------------------------------------------------------------------------------------
+HCWeakRefRef HCWeakRefCreate(HCRef object) {
+    // NOTE: Weak references are never allocated in an arena or confined to a thread, since they are shared through the side table
+    HCBoolean isTracked = object != NULL && HCObjectTagOf(object) == HCObjectTagNone;
+    HCArenaRef previous = HCArenaBeginCreatingObjects(NULL);
+    HCWeakRefRef self = HCObjectAllocate(sizeof(HCWeakRef));
+    HCArenaEndCreatingObjects(previous);
+    HCWeakRefInit(self, object, isTracked);
+    HCObjectMarkShared(self);
+    if (!isTracked) {
+        return self;
+    }
+    
+    // Enter the weak reference in the side table and mark its object as weakly referenced
+    pthread_mutex_lock(&HCWeakRefTableLock);
+    if (HCWeakRefTableCount >= HCWeakRefTableCapacity) {
+        HCWeakRefTableGrow();
+    }
+    HCInteger bucketIndex = HCWeakRefTableBucketIndex(object, HCWeakRefTableCapacity);
+    self->next = HCWeakRefTableBuckets[bucketIndex];
+    HCWeakRefTableBuckets[bucketIndex] = self;
+    HCWeakRefTableCount++;
+    atomic_fetch_or_explicit(&((HCObjectRef)object)->flags, HCObjectFlagWeaklyReferenced, memory_order_relaxed);
+    pthread_mutex_unlock(&HCWeakRefTableLock);
+    return self;
+}
+
+void HCWeakRefInit(void* memory, HCRef object, HCBoolean isTracked) {
+    HCObjectInit(memory);
+    HCWeakRefRef self = memory;
+    self->base.type = HCWeakRefType;
+    self->object = object;
+    self->isTracked = isTracked;
+    self->next = NULL;
+}
+
+void HCWeakRefDestroy(HCWeakRefRef self) {
+    if (!self->isTracked) {
+        return;
+    }
+    
+    // Remove the weak reference from the side table, unless it was removed when its object was released
+    pthread_mutex_lock(&HCWeakRefTableLock);
+    if (self->object != NULL) {
+        HCInteger bucketIndex = HCWeakRefTableBucketIndex(self->object, HCWeakRefTableCapacity);
+        HCBoolean isObjectWeaklyReferenced = false;
+        for (HCWeakRefRef* link = &HCWeakRefTableBuckets[bucketIndex]; *link != NULL;) {
+            if (*link == self) {
+                *link = self->next;
+                HCWeakRefTableCount--;
+                continue;
+            }
+            isObjectWeaklyReferenced = isObjectWeaklyReferenced || (*link)->object == self->object;
+            link = &(*link)->next;
+        }
+        
+        // Clear the mark on the object if no other weak references to it remain
+        // NOTE: The object cannot be deallocated while the lock is held, since releasing it must first clear its weak references
+        if (!isObjectWeaklyReferenced) {
+            atomic_fetch_and_explicit(&((HCObjectRef)self->object)->flags, (uint16_t)~HCObjectFlagWeaklyReferenced, memory_order_relaxed);
+        }
+    }
+    pthread_mutex_unlock(&HCWeakRefTableLock);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Polymorphic Functions
+//----------------------------------------------------------------------------------------------------------------------------------
+HCBoolean HCWeakRefIsEqual(HCWeakRefRef self, HCWeakRefRef other) {
+    return HCObjectIsEqual((HCObjectRef)self, (HCObjectRef)other);
+}
+
+HCInteger HCWeakRefHashValue(HCWeakRefRef self) {
+    return HCObjectHashValue((HCObjectRef)self);
+}
+
+void HCWeakRefPrint(HCWeakRefRef self, FILE* stream) {
+    fprintf(stream, "<%s@%p,cleared:%s>", self->base.type->name, self, HCWeakRefIsCleared(self) ? "true" : "false");
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Loading
+//----------------------------------------------------------------------------------------------------------------------------------
+HCRef HCWeakRefLoadRetained(HCWeakRefRef self) {
+    if (!self->isTracked) {
+        return HCRetain(self->object);
+    }
+    
+    // Retain the object only if it is not being released, which is decided with the lock held so it cannot be deallocated meanwhile
+    pthread_mutex_lock(&HCWeakRefTableLock);
+    HCRef object = self->object;
+    if (object != NULL && !HCObjectRetainIfReferenced(object)) {
+        object = NULL;
+    }
+    pthread_mutex_unlock(&HCWeakRefTableLock);
+    return object;
+}
+
+HCBoolean HCWeakRefIsCleared(HCWeakRefRef self) {
+    if (!self->isTracked) {
+        return self->object == NULL;
+    }
+    pthread_mutex_lock(&HCWeakRefTableLock);
+    HCBoolean isCleared = self->object == NULL;
+    pthread_mutex_unlock(&HCWeakRefTableLock);
+    return isCleared;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Side Table
+//----------------------------------------------------------------------------------------------------------------------------------
+void HCWeakRefClearObject(HCObjectRef object) {
+    // Clear and remove all weak references to the object from the side table
+    pthread_mutex_lock(&HCWeakRefTableLock);
+    HCInteger bucketIndex = HCWeakRefTableBucketIndex(object, HCWeakRefTableCapacity);
+    for (HCWeakRefRef* link = &HCWeakRefTableBuckets[bucketIndex]; *link != NULL;) {
+        HCWeakRefRef entry = *link;
+        if (entry->object == object) {
+            entry->object = NULL;
+            *link = entry->next;
+            HCWeakRefTableCount--;
+            continue;
+        }
+        link = &entry->next;
+    }
+    atomic_fetch_and_explicit(&object->flags, (uint16_t)~HCObjectFlagWeaklyReferenced, memory_order_relaxed);
+    pthread_mutex_unlock(&HCWeakRefTableLock);
+}
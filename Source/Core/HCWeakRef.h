@@ -0,0 +1,80 @@
+///
+/// @file HCWeakRef.h
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+/// @brief Reference to an object that does not keep the object alive.
+///
+
+#ifndef HCWeakRef_h
+#define HCWeakRef_h
+
+#include "HCObject.h"
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Type
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Type of @c HCWeakRef instances.
+extern HCType HCWeakRefType;
+
+/// A reference to an @c HCWeakRef instance.
+typedef struct HCWeakRef* HCWeakRefRef;
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Construction
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Creates a weak reference to an object.
+///
+/// A weak reference does not retain its object. Once the object's last reference is released, loading the weak reference produces @c NULL.
+/// Weak references are kept in a side table, so objects that are never weakly referenced do not pay for them.
+/// A weak reference to a thread-confined object must only be loaded on the thread the object is confined to.
+///
+/// @param object The object to weakly reference.
+/// @returns A reference to the created weak reference.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCWeakRefRef HCWeakRefCreate(HCRef object);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Polymorphic Functions
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Determines if a weak reference is equal to another weak reference.
+/// @param self A reference to the weak reference to examine.
+/// @param other The other weak reference to evaluate equality against.
+/// @returns @c true if @c self and @c other are the same weak reference.
+HCBoolean HCWeakRefIsEqual(HCWeakRefRef self, HCWeakRefRef other);
+
+/// Calculates a hash value for a weak reference.
+/// @param self A reference to the weak reference.
+/// @returns A hash value determined using only the identity of the weak reference.
+HCInteger HCWeakRefHashValue(HCWeakRefRef self);
+
+/// Prints a weak reference to a stream.
+/// @param self A reference to the weak reference.
+/// @param stream The stream to which the weak reference should be printed.
+void HCWeakRefPrint(HCWeakRefRef self, FILE* stream);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Loading
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Obtains a strong reference to the object of a weak reference, if the object has not been released.
+/// @param self A reference to the weak reference.
+/// @returns A reference to the object of the weak reference, or @c NULL if all other references to the object have been released.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCRef HCWeakRefLoadRetained(HCWeakRefRef self);
+
+/// Determines if the object of a weak reference has been released.
+///
+/// A weak reference that is not cleared may become cleared at any time if its object is being released on another thread.
+///
+/// @param self A reference to the weak reference.
+/// @returns @c true if the object of the weak reference has been released, or @c false otherwise.
+HCBoolean HCWeakRefIsCleared(HCWeakRefRef self);
+
+#endif /* HCWeakRef_h */
@@ -0,0 +1,46 @@
+///
+/// @file HCWeakRef_Internal.h
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#ifndef HCWeakRef_Internal_h
+#define HCWeakRef_Internal_h
+
+#include "HCObject_Internal.h"
+#include "HCWeakRef.h"
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Definitions
+//----------------------------------------------------------------------------------------------------------------------------------
+#define HCWeakRefTableMinimumCapacityStatic (64)
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Object Type
+//----------------------------------------------------------------------------------------------------------------------------------
+// NOTE: Weak references to heap objects are entries in a global side table chained by object address, and the weakly referenced
+//       object records that it has entries with HCObjectFlagWeaklyReferenced. When the object's reference count reaches zero its
+//       entries are cleared and removed from the table. Null and tagged references are never released, so weak references to them
+//       are not entered in the table.
+typedef struct HCWeakRef {
+    HCObject base;
+    HCRef object;
+    HCBoolean isTracked;
+    struct HCWeakRef* next;
+} HCWeakRef;
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Construction
+//----------------------------------------------------------------------------------------------------------------------------------
+void HCWeakRefInit(void* memory, HCRef object, HCBoolean isTracked);
+void HCWeakRefDestroy(HCWeakRefRef self);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Side Table
+//----------------------------------------------------------------------------------------------------------------------------------
+void HCWeakRefClearObject(HCObjectRef object);
+
+#endif /* HCWeakRef_Internal_h */
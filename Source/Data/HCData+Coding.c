@@ -0,0 +1,236 @@
+///
+/// @file HCData+Coding.c
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#include "HCData+Coding.h"
+#include "HCData_Internal.h"
+#include <string.h>
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Definitions
+//----------------------------------------------------------------------------------------------------------------------------------
+#define HCDataCodingVarIntegerSizeMaximumStatic (10)
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Writing
+//----------------------------------------------------------------------------------------------------------------------------------
+HCDataWriter HCDataWriterBegin(HCDataRef data) {
+    return (HCDataWriter){ .data = data };
+}
+
+void HCDataWriterReserve(HCDataWriter* writer, HCInteger size) {
+    HCDataReserve(writer->data, writer->data->size + size);
+}
+
+static inline HCByte* HCDataWriterAdvance(HCDataWriter* writer, HCInteger size) {
+    // Extend the contents of the data object, and return the extended region to be encoded into
+    // NOTE: Appending within capacity only updates the size, so values are encoded in place without an intermediate copy
+    HCDataAddBytes(writer->data, size, NULL);
+    return writer->data->data + writer->data->size - size;
+}
+
+void HCDataWriterWriteBytes(HCDataWriter* writer, HCInteger size, const HCByte* bytes) {
+    HCDataAddBytes(writer->data, size, bytes);
+}
+
+void HCDataWriterWriteUInt8(HCDataWriter* writer, uint8_t value) {
+    HCByte* bytes = HCDataWriterAdvance(writer, sizeof(value));
+    bytes[0] = value;
+}
+
+void HCDataWriterWriteUInt16(HCDataWriter* writer, uint16_t value) {
+    HCByte* bytes = HCDataWriterAdvance(writer, sizeof(value));
+    bytes[0] = (HCByte)value;
+    bytes[1] = (HCByte)(value >> 8);
+}
+
+void HCDataWriterWriteUInt32(HCDataWriter* writer, uint32_t value) {
+    HCByte* bytes = HCDataWriterAdvance(writer, sizeof(value));
+    for (HCInteger index = 0; index < (HCInteger)sizeof(value); index++) {
+        bytes[index] = (HCByte)(value >> (index * 8));
+    }
+}
+
+void HCDataWriterWriteUInt64(HCDataWriter* writer, uint64_t value) {
+    HCByte* bytes = HCDataWriterAdvance(writer, sizeof(value));
+    for (HCInteger index = 0; index < (HCInteger)sizeof(value); index++) {
+        bytes[index] = (HCByte)(value >> (index * 8));
+    }
+}
+
+void HCDataWriterWriteBoolean(HCDataWriter* writer, HCBoolean value) {
+    HCDataWriterWriteUInt8(writer, value ? 1 : 0);
+}
+
+void HCDataWriterWriteInteger(HCDataWriter* writer, HCInteger value) {
+    HCDataWriterWriteUInt64(writer, (uint64_t)value);
+}
+
+void HCDataWriterWriteReal(HCDataWriter* writer, HCReal value) {
+    uint64_t bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+    HCDataWriterWriteUInt64(writer, bits);
+}
+
+void HCDataWriterWriteVarUInteger(HCDataWriter* writer, uint64_t value) {
+    // Encode into a local buffer so the data object is extended only once
+    HCByte encoded[HCDataCodingVarIntegerSizeMaximumStatic];
+    HCInteger size = 0;
+    while (value >= 0x80) {
+        encoded[size++] = (HCByte)(value | 0x80);
+        value >>= 7;
+    }
+    encoded[size++] = (HCByte)value;
+    HCDataAddBytes(writer->data, size, encoded);
+}
+
+void HCDataWriterWriteVarInteger(HCDataWriter* writer, HCInteger value) {
+    // Zig-zag encode so values of small magnitude have short encodings regardless of sign
+    HCDataWriterWriteVarUInteger(writer, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+}
+
+void HCDataWriterWriteBlob(HCDataWriter* writer, HCInteger size, const HCByte* bytes) {
+    HCDataWriterWriteVarUInteger(writer, (uint64_t)size);
+    HCDataAddBytes(writer->data, size, bytes);
+}
+
+void HCDataWriterWriteString(HCDataWriter* writer, HCStringRef string) {
+    HCDataWriterWriteBlob(writer, HCStringCodeUnitCount(string), (const HCByte*)HCStringAsCString(string));
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Reading
+//----------------------------------------------------------------------------------------------------------------------------------
+HCDataReader HCDataReaderBegin(HCDataRef data) {
+    return (HCDataReader){ .data = data, .position = 0, .failed = false };
+}
+
+HCBoolean HCDataReaderIsAtEnd(const HCDataReader* reader) {
+    return reader->failed || reader->position >= reader->data->size;
+}
+
+HCBoolean HCDataReaderHasFailed(const HCDataReader* reader) {
+    return reader->failed;
+}
+
+const HCByte* HCDataReaderReadBytes(HCDataReader* reader, HCInteger size) {
+    // Fail if the requested size is not available
+    if (reader->failed || size < 0 || size > reader->data->size - reader->position) {
+        reader->failed = true;
+        return NULL;
+    }
+    const HCByte* bytes = reader->data->data + reader->position;
+    reader->position += size;
+    return bytes;
+}
+
+uint8_t HCDataReaderReadUInt8(HCDataReader* reader) {
+    const HCByte* bytes = HCDataReaderReadBytes(reader, sizeof(uint8_t));
+    return bytes == NULL ? 0 : bytes[0];
+}
+
+uint16_t HCDataReaderReadUInt16(HCDataReader* reader) {
+    const HCByte* bytes = HCDataReaderReadBytes(reader, sizeof(uint16_t));
+    return bytes == NULL ? 0 : (uint16_t)(bytes[0] | bytes[1] << 8);
+}
+
+uint32_t HCDataReaderReadUInt32(HCDataReader* reader) {
+    const HCByte* bytes = HCDataReaderReadBytes(reader, sizeof(uint32_t));
+    if (bytes == NULL) {
+        return 0;
+    }
+    uint32_t value = 0;
+    for (HCInteger index = 0; index < (HCInteger)sizeof(value); index++) {
+        value |= (uint32_t)bytes[index] << (index * 8);
+    }
+    return value;
+}
+
+uint64_t HCDataReaderReadUInt64(HCDataReader* reader) {
+    const HCByte* bytes = HCDataReaderReadBytes(reader, sizeof(uint64_t));
+    if (bytes == NULL) {
+        return 0;
+    }
+    uint64_t value = 0;
+    for (HCInteger index = 0; index < (HCInteger)sizeof(value); index++) {
+        value |= (uint64_t)bytes[index] << (index * 8);
+    }
+    return value;
+}
+
+HCBoolean HCDataReaderReadBoolean(HCDataReader* reader) {
+    return HCDataReaderReadUInt8(reader) != 0;
+}
+
+HCInteger HCDataReaderReadInteger(HCDataReader* reader) {
+    return (HCInteger)HCDataReaderReadUInt64(reader);
+}
+
+HCReal HCDataReaderReadReal(HCDataReader* reader) {
+    uint64_t bits = HCDataReaderReadUInt64(reader);
+    HCReal value = 0.0;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+uint64_t HCDataReaderReadVarUInteger(HCDataReader* reader) {
+    // Accumulate 7-bit groups until one without the continuation bit is found
+    // NOTE: Encodings longer than the maximum size, or whose last group overflows 64 bits, are malformed
+    uint64_t value = 0;
+    for (HCInteger index = 0; index < HCDataCodingVarIntegerSizeMaximumStatic; index++) {
+        const HCByte* bytes = HCDataReaderReadBytes(reader, 1);
+        if (bytes == NULL) {
+            return 0;
+        }
+        if (index == HCDataCodingVarIntegerSizeMaximumStatic - 1 && bytes[0] > 0x01) {
+            break;
+        }
+        value |= (uint64_t)(bytes[0] & 0x7F) << (index * 7);
+        if ((bytes[0] & 0x80) == 0) {
+            return value;
+        }
+    }
+    reader->failed = true;
+    return 0;
+}
+
+HCInteger HCDataReaderReadVarInteger(HCDataReader* reader) {
+    uint64_t value = HCDataReaderReadVarUInteger(reader);
+    return (HCInteger)(value >> 1) ^ -(HCInteger)(value & 1);
+}
+
+const HCByte* HCDataReaderReadBlob(HCDataReader* reader, HCInteger* size) {
+    // Decode the size, and fail if it is not representable or not available
+    uint64_t blobSize = HCDataReaderReadVarUInteger(reader);
+    const HCByte* bytes = blobSize > (uint64_t)INT64_MAX ? NULL : HCDataReaderReadBytes(reader, (HCInteger)blobSize);
+    if (bytes == NULL) {
+        reader->failed = true;
+        *size = 0;
+        return NULL;
+    }
+    *size = (HCInteger)blobSize;
+    return bytes;
+}
+
+HCDataRef HCDataReaderReadBlobDataRetained(HCDataReader* reader) {
+    HCInteger size = 0;
+    const HCByte* bytes = HCDataReaderReadBlob(reader, &size);
+    if (bytes == NULL) {
+        return NULL;
+    }
+    return HCDataCreateSlice(reader->data, bytes - reader->data->data, size);
+}
+
+HCStringRef HCDataReaderReadStringRetained(HCDataReader* reader) {
+    HCInteger size = 0;
+    const HCByte* bytes = HCDataReaderReadBlob(reader, &size);
+    if (bytes == NULL) {
+        return NULL;
+    }
+    return HCStringCreateWithBytes(HCStringEncodingUTF8, size, bytes);
+}
@@ -0,0 +1,208 @@
+///
+/// @file HCData+Coding.h
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+/// @brief Cursors that encode values to and decode values from the contents of data objects.
+///
+
+#ifndef HCData_Coding_h
+#define HCData_Coding_h
+
+#include "HCData.h"
+#include "HCString.h"
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Definitions
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Structure used to track encoding of values appended to the contents of a data object.
+///
+/// Fixed-width values are encoded little-endian. Variable-width integers are encoded in base 128 with the least significant group first, and signed variable-width integers are zig-zag encoded beforehand. Blobs are encoded as a variable-width size followed by their bytes.
+typedef struct HCDataWriter {
+    /// The data object to which encoded values are appended.
+    HCDataRef data;
+} HCDataWriter;
+
+/// Structure used to track decoding of values from the contents of a data object.
+///
+/// Decoding past the end of the contents or decoding a malformed value marks the reader as failed, after which all decoding functions return zero values.
+typedef struct HCDataReader {
+    /// The data object from which values are decoded.
+    HCDataRef data;
+    
+    /// Offset in bytes of the next value to be decoded.
+    HCInteger position;
+    
+    /// Whether decoding has failed.
+    HCBoolean failed;
+} HCDataReader;
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Writing
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Begins encoding values to the end of a data object's contents.
+/// @param data The data object to which encoded values should be appended. The writer does not retain @c data.
+/// @returns A writer that appends to @c data.
+HCDataWriter HCDataWriterBegin(HCDataRef data);
+
+/// Ensures the data object of a writer can have a number of bytes appended without its storage growing.
+/// @param writer The writer to modify.
+/// @param size The size in bytes expected to be appended.
+void HCDataWriterReserve(HCDataWriter* writer, HCInteger size);
+
+/// Appends raw bytes without a size prefix.
+/// @param writer The writer to append to.
+/// @param size The size in bytes of @c bytes.
+/// @param bytes The bytes to append. Must point to a buffer of at least @c size bytes.
+void HCDataWriterWriteBytes(HCDataWriter* writer, HCInteger size, const HCByte* bytes);
+
+/// Appends an 8-bit unsigned integer.
+/// @param writer The writer to append to.
+/// @param value The value to append.
+void HCDataWriterWriteUInt8(HCDataWriter* writer, uint8_t value);
+
+/// Appends a 16-bit unsigned integer in little-endian byte order.
+/// @param writer The writer to append to.
+/// @param value The value to append.
+void HCDataWriterWriteUInt16(HCDataWriter* writer, uint16_t value);
+
+/// Appends a 32-bit unsigned integer in little-endian byte order.
+/// @param writer The writer to append to.
+/// @param value The value to append.
+void HCDataWriterWriteUInt32(HCDataWriter* writer, uint32_t value);
+
+/// Appends a 64-bit unsigned integer in little-endian byte order.
+/// @param writer The writer to append to.
+/// @param value The value to append.
+void HCDataWriterWriteUInt64(HCDataWriter* writer, uint64_t value);
+
+/// Appends a boolean value as a single byte of @c 0 or @c 1.
+/// @param writer The writer to append to.
+/// @param value The value to append.
+void HCDataWriterWriteBoolean(HCDataWriter* writer, HCBoolean value);
+
+/// Appends an integer value as 8 bytes in little-endian byte order.
+/// @param writer The writer to append to.
+/// @param value The value to append.
+void HCDataWriterWriteInteger(HCDataWriter* writer, HCInteger value);
+
+/// Appends a real value as 8 bytes of its IEEE 754 representation in little-endian byte order.
+/// @param writer The writer to append to.
+/// @param value The value to append.
+void HCDataWriterWriteReal(HCDataWriter* writer, HCReal value);
+
+/// Appends an unsigned integer in variable-width encoding, using 1 byte for values below 128 and up to 10 bytes.
+/// @param writer The writer to append to.
+/// @param value The value to append.
+void HCDataWriterWriteVarUInteger(HCDataWriter* writer, uint64_t value);
+
+/// Appends an integer in zig-zag variable-width encoding, using 1 byte for values from -64 to 63 and up to 10 bytes.
+/// @param writer The writer to append to.
+/// @param value The value to append.
+void HCDataWriterWriteVarInteger(HCDataWriter* writer, HCInteger value);
+
+/// Appends bytes prefixed by their size in variable-width encoding.
+/// @param writer The writer to append to.
+/// @param size The size in bytes of @c bytes.
+/// @param bytes The bytes to append. Must point to a buffer of at least @c size bytes.
+void HCDataWriterWriteBlob(HCDataWriter* writer, HCInteger size, const HCByte* bytes);
+
+/// Appends the UTF-8 code units of a string as a blob.
+/// @param writer The writer to append to.
+/// @param string The string to append.
+void HCDataWriterWriteString(HCDataWriter* writer, HCStringRef string);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Reading
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Begins decoding values from the start of a data object's contents.
+/// @param data The data object from which values should be decoded. The reader does not retain @c data, and @c data must not be modified while decoding.
+/// @returns A reader positioned at the start of the contents of @c data.
+HCDataReader HCDataReaderBegin(HCDataRef data);
+
+/// Determines if a reader has decoded all of the contents of its data object.
+/// @param reader The reader to examine.
+/// @returns @c true if no bytes remain to be decoded, or if decoding has failed.
+HCBoolean HCDataReaderIsAtEnd(const HCDataReader* reader);
+
+/// Determines if a reader has failed to decode a value.
+/// @param reader The reader to examine.
+/// @returns @c true if a value was read past the end of the contents or was malformed.
+HCBoolean HCDataReaderHasFailed(const HCDataReader* reader);
+
+/// Decodes raw bytes without copying them.
+/// @param reader The reader to decode from.
+/// @param size The size in bytes to decode.
+/// @returns A pointer to @c size bytes within the contents of the data object, or @c NULL if fewer than @c size bytes remain. Valid until the data object is next modified or released.
+const HCByte* HCDataReaderReadBytes(HCDataReader* reader, HCInteger size);
+
+/// Decodes an 8-bit unsigned integer.
+/// @param reader The reader to decode from.
+/// @returns The decoded value, or @c 0 if decoding failed.
+uint8_t HCDataReaderReadUInt8(HCDataReader* reader);
+
+/// Decodes a 16-bit unsigned integer in little-endian byte order.
+/// @param reader The reader to decode from.
+/// @returns The decoded value, or @c 0 if decoding failed.
+uint16_t HCDataReaderReadUInt16(HCDataReader* reader);
+
+/// Decodes a 32-bit unsigned integer in little-endian byte order.
+/// @param reader The reader to decode from.
+/// @returns The decoded value, or @c 0 if decoding failed.
+uint32_t HCDataReaderReadUInt32(HCDataReader* reader);
+
+/// Decodes a 64-bit unsigned integer in little-endian byte order.
+/// @param reader The reader to decode from.
+/// @returns The decoded value, or @c 0 if decoding failed.
+uint64_t HCDataReaderReadUInt64(HCDataReader* reader);
+
+/// Decodes a boolean value encoded by @c HCDataWriterWriteBoolean().
+/// @param reader The reader to decode from.
+/// @returns The decoded value, or @c false if decoding failed.
+HCBoolean HCDataReaderReadBoolean(HCDataReader* reader);
+
+/// Decodes an integer value encoded by @c HCDataWriterWriteInteger().
+/// @param reader The reader to decode from.
+/// @returns The decoded value, or @c 0 if decoding failed.
+HCInteger HCDataReaderReadInteger(HCDataReader* reader);
+
+/// Decodes a real value encoded by @c HCDataWriterWriteReal().
+/// @param reader The reader to decode from.
+/// @returns The decoded value, or @c 0.0 if decoding failed.
+HCReal HCDataReaderReadReal(HCDataReader* reader);
+
+/// Decodes an unsigned integer encoded by @c HCDataWriterWriteVarUInteger().
+/// @param reader The reader to decode from.
+/// @returns The decoded value, or @c 0 if decoding failed.
+uint64_t HCDataReaderReadVarUInteger(HCDataReader* reader);
+
+/// Decodes an integer encoded by @c HCDataWriterWriteVarInteger().
+/// @param reader The reader to decode from.
+/// @returns The decoded value, or @c 0 if decoding failed.
+HCInteger HCDataReaderReadVarInteger(HCDataReader* reader);
+
+/// Decodes a blob encoded by @c HCDataWriterWriteBlob() without copying its bytes.
+/// @param reader The reader to decode from.
+/// @param size Set to the size in bytes of the blob, or @c 0 if decoding failed.
+/// @returns A pointer to the bytes of the blob within the contents of the data object, or @c NULL if decoding failed. Valid until the data object is next modified or released.
+const HCByte* HCDataReaderReadBlob(HCDataReader* reader, HCInteger* size);
+
+/// Decodes a blob encoded by @c HCDataWriterWriteBlob() as a data object sharing the storage of the reader's data object.
+/// @param reader The reader to decode from.
+/// @returns A reference to a data object created by @c HCDataCreateSlice() containing the blob, or @c NULL if decoding failed.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCDataRef HCDataReaderReadBlobDataRetained(HCDataReader* reader);
+
+/// Decodes a string encoded by @c HCDataWriterWriteString().
+/// @param reader The reader to decode from.
+/// @returns A reference to the decoded string, or @c NULL if decoding failed.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCStringRef HCDataReaderReadStringRetained(HCDataReader* reader);
+
+#endif /* HCData_Coding_h */
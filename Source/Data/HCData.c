@@ -10,6 +10,11 @@
 #include "HCData_Internal.h"
 #include <string.h>
 #include <math.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Object Type
@@ -18,6 +23,8 @@ const HCObjectTypeData HCDataTypeDataInstance = {
     .base = {
         .ancestor = &HCObjectTypeDataInstance.base,
         .name = "HCData",
+        .identifier = HCTypeIdentifierData,
+        .kindMask = HCTypeKindMaskForIdentifier(HCTypeIdentifierObject) | HCTypeKindMaskForIdentifier(HCTypeIdentifierData),
     },
     .isEqual = (void*)HCDataIsEqual,
     .hashValue = (void*)HCDataHashValue,
@@ -34,11 +41,84 @@ HCDataRef HCDataCreate() {
 }
 
 HCDataRef HCDataCreateWithBytes(HCInteger size, const HCByte* bytes) {
-    HCDataRef self = calloc(sizeof(HCData), 1);
+    HCDataRef self = HCObjectAllocate(sizeof(HCData));
     HCDataInit(self, size, bytes);
     return self;
 }
 
+HCDataRef HCDataCreateWithCapacity(HCInteger capacity) {
+    HCDataRef self = HCObjectAllocate(sizeof(HCData));
+    HCDataInitWithCapacity(self, capacity);
+    return self;
+}
+
+HCDataRef HCDataCreateWithContentsOfFileMapped(const char* path) {
+    // Open the file and determine its size
+    // NOTE: The file is opened without blocking, so that opening a pipe does not wait for a writer before it is rejected
+    int file = open(path, O_RDONLY | O_NONBLOCK);
+    if (file < 0) {
+        return NULL;
+    }
+    struct stat fileStatus;
+    if (fstat(file, &fileStatus) != 0 || !S_ISREG(fileStatus.st_mode)) {
+        close(file);
+        return NULL;
+    }
+    
+    // NOTE: Empty files cannot be mapped, and virtual files report a size of zero, so read them into owned storage
+    if (fileStatus.st_size == 0) {
+        HCDataRef self = HCDataCreateWithCapacity(HCDataMinimumCapacityStatic);
+        while (true) {
+            if (self->size == self->capacity) {
+                HCDataResize(self, self->capacity * 2);
+            }
+            ssize_t count = read(file, self->data + self->size, self->capacity - self->size);
+            if (count == 0) {
+                break;
+            }
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                HCRelease(self);
+                self = NULL;
+                break;
+            }
+            self->size += count;
+        }
+        close(file);
+        return self;
+    }
+    
+    // Map the file contents, which remain valid after the file is closed
+    void* bytes = mmap(NULL, fileStatus.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if (bytes == MAP_FAILED) {
+        return NULL;
+    }
+    
+    HCDataRef self = HCObjectAllocate(sizeof(HCData));
+    HCDataInitWithoutCopying(self, fileStatus.st_size, bytes);
+    self->storage = HCDataStorageMapped;
+    return self;
+}
+
+HCDataRef HCDataCreateSlice(HCDataRef data, HCInteger offset, HCInteger length) {
+    // Clamp the slice to the contents of the data object
+    offset = offset < 0 ? 0 : (offset > data->size ? data->size : offset);
+    length = length < 0 ? 0 : (length > data->size - offset ? data->size - offset : length);
+    
+    // Point into the storage of the data object, retaining the data object that owns the storage so it outlives the slice
+    // NOTE: The owning data object is only marked as sliced, so that it retires its storage rather than modifying it in place
+    HCDataRef ownerData = data->storage == HCDataStorageShared ? data->storageData : data;
+    atomic_store_explicit(&ownerData->isSliced, true, memory_order_relaxed);
+    HCDataRef self = HCObjectAllocate(sizeof(HCData));
+    HCDataInitWithoutCopying(self, length, data->data == NULL ? NULL : data->data + offset);
+    self->storage = HCDataStorageShared;
+    self->storageData = HCRetain(ownerData);
+    return self;
+}
+
 HCDataRef HCDataCreateWithBoolean(HCBoolean value) {
     return HCDataCreateWithBytes(sizeof(value), (HCByte*)&value);
 }
@@ -64,11 +144,81 @@ void HCDataInitWithoutCopying(void* memory, HCInteger size, HCByte* data) {
     HCDataRef self = memory;
     self->base.type = HCDataType;
     self->size = size;
+    self->capacity = size;
     self->data = data;
+    self->hashValue = 0;
+    self->storage = HCDataStorageOwned;
+    self->storageData = NULL;
+    self->isSliced = false;
+    self->retiredData = NULL;
+}
+
+void HCDataInitWithCapacity(void* memory, HCInteger capacity) {
+    capacity = capacity < 0 ? 0 : capacity;
+    HCDataInitWithoutCopying(memory, 0, malloc(capacity));
+    HCDataRef self = memory;
+    self->capacity = capacity;
 }
 
 void HCDataDestroy(HCDataRef self) {
-    free(self->data);
+    HCDataReleaseStorage(self);
+    HCRelease(self->retiredData);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Storage
+//----------------------------------------------------------------------------------------------------------------------------------
+void HCDataResize(HCDataRef self, HCInteger capacity) {
+    // Copy mapped, shared, or sliced storage into owned storage, since it cannot be resized or modified in place
+    HCBoolean isSliced = self->storage != HCDataStorageShared && atomic_load_explicit(&self->isSliced, memory_order_relaxed);
+    if (self->storage != HCDataStorageOwned || isSliced) {
+        HCByte* data = capacity == 0 ? NULL : malloc(capacity);
+        if (self->size > 0) {
+            memcpy(data, self->data, self->size);
+        }
+        if (isSliced) {
+            HCDataRetireStorage(self);
+        }
+        else {
+            HCDataReleaseStorage(self);
+        }
+        self->storage = HCDataStorageOwned;
+        self->storageData = NULL;
+        self->data = data;
+        self->capacity = capacity;
+        return;
+    }
+    
+    // NOTE: The buffer is freed rather than resized to zero bytes, since realloc() of zero bytes is implementation-defined
+    if (capacity == 0) {
+        free(self->data);
+        self->data = NULL;
+        self->capacity = 0;
+        return;
+    }
+    self->data = realloc(self->data, capacity);
+    self->capacity = capacity;
+    // TODO: Failable
+}
+
+void HCDataReleaseStorage(HCDataRef self) {
+    switch (self->storage) {
+        case HCDataStorageOwned: free(self->data); break;
+        case HCDataStorageMapped: munmap(self->data, self->capacity); break;
+        case HCDataStorageShared: HCRelease(self->storageData); break;
+    }
+}
+
+void HCDataRetireStorage(HCDataRef self) {
+    // Move the storage to a retired data object that is never modified, and keep it until the data object is destroyed
+    // NOTE: This keeps the storage valid for slices, which retain the data object that owned the storage rather than the storage
+    HCDataRef retiredData = HCObjectAllocate(sizeof(HCData));
+    HCDataInitWithoutCopying(retiredData, self->size, self->data);
+    retiredData->capacity = self->capacity;
+    retiredData->storage = self->storage;
+    retiredData->retiredData = self->retiredData;
+    self->retiredData = retiredData;
+    atomic_store_explicit(&self->isSliced, false, memory_order_relaxed);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -82,12 +232,15 @@ HCBoolean HCDataIsEqual(HCDataRef self, HCDataRef other) {
 }
 
 HCInteger HCDataHashValue(HCDataRef self) {
-    HCInteger hash = 5381;
-    for (HCInteger byteIndex = 0; byteIndex < self->size; byteIndex++) {
-        HCByte b = self->data[byteIndex];
-        hash = ((hash << 5) + hash) + b;
+    // Hash the bytes once and cache the result until the data is changed
+    // NOTE: A zero value marks the hash as not yet computed, so data hashing to zero is hashed on each call
+    // NOTE: Threads computing the hash at the same time store the same value, so relaxed atomic access is sufficient
+    HCInteger hashValue = atomic_load_explicit(&self->hashValue, memory_order_relaxed);
+    if (hashValue == 0) {
+        hashValue = HCBytesHashValue(self->size, self->data);
+        atomic_store_explicit(&self->hashValue, hashValue, memory_order_relaxed);
     }
-    return hash;
+    return hashValue;
 }
 
 void HCDataPrint(HCDataRef self, FILE* stream) {
@@ -105,6 +258,10 @@ HCInteger HCDataSize(HCDataRef self) {
     return self->size;
 }
 
+HCInteger HCDataCapacity(HCDataRef self) {
+    return self->capacity;
+}
+
 const HCByte* HCDataBytes(HCDataRef self) {
     return self->data;
 }
@@ -140,7 +297,11 @@ HCReal HCDataAsReal(HCDataRef self) {
 // MARK: - Operations
 //----------------------------------------------------------------------------------------------------------------------------------
 void HCDataChangeBytes(HCDataRef self, HCInteger location, HCInteger size, const HCByte* bytes) {
+    if (self->storage != HCDataStorageOwned || atomic_load_explicit(&self->isSliced, memory_order_relaxed)) {
+        HCDataResize(self, self->size);
+    }
     memcpy(self->data + location, bytes, size);
+    atomic_store_explicit(&self->hashValue, 0, memory_order_relaxed);
 }
 
 void HCDataClear(HCDataRef self) {
@@ -148,22 +309,47 @@ void HCDataClear(HCDataRef self) {
 }
 
 void HCDataAddBytes(HCDataRef self, HCInteger size, const HCByte* bytes) {
-    self->data = realloc(self->data, self->size + size);
+    if (size <= 0) {
+        return;
+    }
+    
+    // Grow the buffer geometrically so that a sequence of appends is amortized linear time
+    // NOTE: Mapped, shared, and sliced storage is always resized, which copies it into owned storage
+    if (self->storage != HCDataStorageOwned || atomic_load_explicit(&self->isSliced, memory_order_relaxed) || self->size + size > self->capacity) {
+        HCInteger increasedCapacity = self->capacity < HCDataMinimumCapacityStatic ? HCDataMinimumCapacityStatic : self->capacity;
+        while (increasedCapacity < self->size + size) {
+            increasedCapacity *= 2;
+        }
+        HCDataResize(self, increasedCapacity);
+    }
+    
     if (bytes != NULL) {
         memcpy(self->data + self->size, bytes, size);
     }
     self->size += size;
-    // TODO: Failable
+    atomic_store_explicit(&self->hashValue, 0, memory_order_relaxed);
 }
 
 void HCDataRemoveBytes(HCDataRef self, HCInteger size) {
     if (size <= 0) {
         return;
     }
-    size = size > self->size ? 0 : self->size - size;
-    self->data = realloc(self->data, size);
-    self->size = size;
-    // TODO: Failable
+    
+    // NOTE: Capacity is retained so that the removed space can be reused, use HCDataShrinkToFit() to release it
+    self->size = size > self->size ? 0 : self->size - size;
+    atomic_store_explicit(&self->hashValue, 0, memory_order_relaxed);
+}
+
+void HCDataReserve(HCDataRef self, HCInteger capacity) {
+    if (capacity > self->capacity) {
+        HCDataResize(self, capacity);
+    }
+}
+
+void HCDataShrinkToFit(HCDataRef self) {
+    if (self->storage == HCDataStorageOwned && self->capacity > self->size) {
+        HCDataResize(self, self->size);
+    }
 }
 
 void HCDataAddBoolean(HCDataRef self, HCBoolean value) {
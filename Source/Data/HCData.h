@@ -40,6 +40,32 @@ HCDataRef HCDataCreate(void);
 ///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
 HCDataRef HCDataCreateWithBytes(HCInteger size, const HCByte* bytes);
 
+/// Creates an empty data object with storage reserved for a number of bytes.
+/// @param capacity The size in bytes that can be added to the data object before its storage must grow.
+/// @returns A reference to the created data object.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCDataRef HCDataCreateWithCapacity(HCInteger capacity);
+
+/// Creates a data object whose contents are a read-only memory mapping of a file.
+///
+/// The file contents are paged in on demand rather than copied. The data object may still be modified, in which case it first copies its contents into storage of its own.
+///
+/// @param path The path of the file to map.
+/// @returns A reference to the created data object, or @c NULL if the file could not be opened, is not a regular file, or could not be mapped or read.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCDataRef HCDataCreateWithContentsOfFileMapped(const char* path);
+
+/// Creates a data object that shares a region of the contents of another data object.
+///
+/// The created data object retains the data object owning the storage of @c data rather than copying the storage. Either data object may still be modified, in which case the modified data object first copies its contents into storage of its own.
+///
+/// @param data The data object whose contents should be shared.
+/// @param offset Offset in bytes of the start of the region. Clamped to @c HCDataSize() of @c data.
+/// @param length The size in bytes of the region. Clamped to the end of the contents of @c data.
+/// @returns A reference to the created data object.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
+HCDataRef HCDataCreateSlice(HCDataRef data, HCInteger offset, HCInteger length);
+
 /// Creates a data object initially populated with the contents of a boolean value.
 /// @param value The boolean value to be copied into the data object.
 /// @returns A reference to the created data object.
@@ -92,6 +118,11 @@ HCBoolean HCDataIsEmpty(HCDataRef self);
 /// @returns The size in bytes of the contents of the data object.
 HCInteger HCDataSize(HCDataRef self);
 
+/// Obtains the size of a data object's storage.
+/// @param self A reference to the data object.
+/// @returns The size in bytes the data object's contents can reach before its storage must grow. Always at least @c HCDataSize().
+HCInteger HCDataCapacity(HCDataRef self);
+
 /// Obtains a data object's contents.
 /// @param self A reference to the data object.
 /// @returns A pointer to a buffer containing the data object's contents. The buffer is of size @c HCDataSize(). The buffer should be considered read-only, and is valid until the data object is next modified or released.
@@ -157,6 +188,18 @@ void HCDataAddBytes(HCDataRef self, HCInteger size, const HCByte* bytes);
 /// @param size The size in bytes of the content area  to the remove from the data object's contents.
 void HCDataRemoveBytes(HCDataRef self, HCInteger size);
 
+/// Ensures a data object has storage for at least a number of bytes.
+///
+/// Appending bytes grows storage geometrically, so reserving is only needed to avoid intermediate growth when the final size is known.
+///
+/// @param self A reference to the data object to modify.
+/// @param capacity The size in bytes the data object's contents should be able to reach without its storage growing.
+void HCDataReserve(HCDataRef self, HCInteger capacity);
+
+/// Releases any storage of a data object beyond its contents.
+/// @param self A reference to the data object to modify.
+void HCDataShrinkToFit(HCDataRef self);
+
 /// Appends a boolean value to a data object's contents.
 ///
 /// Functions as if @code HCDataAddBytes(self, sizeof(HCBoolean), (HCByte*)&value) @endcode were called.
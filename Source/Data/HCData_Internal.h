@@ -13,13 +13,33 @@
 #include "../Core/HCObject_Internal.h"
 #include "HCData.h"
 
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Definitions
+//----------------------------------------------------------------------------------------------------------------------------------
+#define HCDataMinimumCapacityStatic (16)
+
+typedef enum HCDataStorage {
+    HCDataStorageOwned,
+    HCDataStorageMapped,
+    HCDataStorageShared,
+} HCDataStorage;
+
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Object Type
 //----------------------------------------------------------------------------------------------------------------------------------
+// NOTE: Data with shared storage points into the bytes of the retained data object that owns the storage.
+//       Sliced storage is retired rather than modified, and retired storage is kept until the owning data object is destroyed.
+//       Mapped, shared, and sliced storage is copied into owned storage before the data object is modified.
 typedef struct HCData {
     HCObject base;
     HCInteger size;
+    HCInteger capacity;
     HCByte* data;
+    HCAtomicInteger hashValue;
+    HCDataStorage storage;
+    HCDataRef storageData;
+    HCAtomicBoolean isSliced;
+    HCDataRef retiredData;
 } HCData;
 
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -27,6 +47,14 @@ typedef struct HCData {
 //----------------------------------------------------------------------------------------------------------------------------------
 void HCDataInit(void* memory, HCInteger size, const HCByte* data);
 void HCDataInitWithoutCopying(void* memory, HCInteger size, HCByte* data);
+void HCDataInitWithCapacity(void* memory, HCInteger capacity);
 void HCDataDestroy(HCDataRef self);
 
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Storage
+//----------------------------------------------------------------------------------------------------------------------------------
+void HCDataResize(HCDataRef self, HCInteger capacity);
+void HCDataReleaseStorage(HCDataRef self);
+void HCDataRetireStorage(HCDataRef self);
+
 #endif /* HCData_Internal_h */
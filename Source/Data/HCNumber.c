@@ -17,6 +17,8 @@ const HCObjectTypeData HCNumberTypeDataInstance = {
     .base = {
         .ancestor = &HCObjectTypeDataInstance.base,
         .name = "HCNumber",
+        .identifier = HCTypeIdentifierNumber,
+        .kindMask = HCTypeKindMaskForIdentifier(HCTypeIdentifierObject) | HCTypeKindMaskForIdentifier(HCTypeIdentifierNumber),
     },
     .isEqual = (void*)HCNumberIsEqual,
     .hashValue = (void*)HCNumberHashValue,
@@ -25,6 +27,28 @@ const HCObjectTypeData HCNumberTypeDataInstance = {
 };
 HCType HCNumberType = (HCType)&HCNumberTypeDataInstance;
 
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Singletons
+//----------------------------------------------------------------------------------------------------------------------------------
+#if !HCObjectTaggedPointersStatic
+#define HCNumberSingletonStatic(valueType, field, v) { .base = { .type = (HCType)&HCNumberTypeDataInstance, .referenceCount = HCObjectReferenceCountImmortalStatic }, .type = valueType, .value = { .field = v } }
+#define HCNumberSingletonInteger4Static(v) HCNumberSingletonStatic(HCNumberValueTypeInteger, integer, v), HCNumberSingletonStatic(HCNumberValueTypeInteger, integer, v + 1), HCNumberSingletonStatic(HCNumberValueTypeInteger, integer, v + 2), HCNumberSingletonStatic(HCNumberValueTypeInteger, integer, v + 3)
+#define HCNumberSingletonInteger16Static(v) HCNumberSingletonInteger4Static(v), HCNumberSingletonInteger4Static(v + 4), HCNumberSingletonInteger4Static(v + 8), HCNumberSingletonInteger4Static(v + 12)
+#define HCNumberSingletonInteger64Static(v) HCNumberSingletonInteger16Static(v), HCNumberSingletonInteger16Static(v + 16), HCNumberSingletonInteger16Static(v + 32), HCNumberSingletonInteger16Static(v + 48)
+
+static HCNumber HCNumberSingletonBooleans[2] = {
+    HCNumberSingletonStatic(HCNumberValueTypeBoolean, boolean, false),
+    HCNumberSingletonStatic(HCNumberValueTypeBoolean, boolean, true),
+};
+
+static HCNumber HCNumberSingletonIntegers[HCNumberSingletonIntegerCountStatic] = {
+    HCNumberSingletonInteger64Static(0),
+    HCNumberSingletonInteger64Static(64),
+    HCNumberSingletonInteger64Static(128),
+    HCNumberSingletonInteger64Static(192),
+};
+#endif
+
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Construction
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -33,21 +57,33 @@ HCNumberRef HCNumberCreate(void) {
 }
 
 HCNumberRef HCNumberCreateWithBoolean(HCBoolean value) {
-    HCNumberRef self = calloc(sizeof(HCNumber), 1);
-    HCNumberValue v = { .boolean = !(!(value)) };
-    HCNumberInit(self, HCNumberValueTypeBoolean, v);
-    return self;
+#if HCObjectTaggedPointersStatic
+    return HCObjectTaggedPointerCreate(HCObjectTagBoolean, value ? 1 : 0);
+#else
+    return &HCNumberSingletonBooleans[value ? 1 : 0];
+#endif
 }
 
 HCNumberRef HCNumberCreateWithInteger(HCInteger value) {
-    HCNumberRef self = calloc(sizeof(HCNumber), 1);
+    // Use an immediate value when possible to avoid allocation
+#if HCObjectTaggedPointersStatic
+    if (value >= HCObjectTaggedIntegerMinimumStatic && value <= HCObjectTaggedIntegerMaximumStatic) {
+        return HCObjectTaggedPointerCreate(HCObjectTagInteger, value);
+    }
+#else
+    if (value >= 0 && value < HCNumberSingletonIntegerCountStatic) {
+        return &HCNumberSingletonIntegers[value];
+    }
+#endif
+    
+    HCNumberRef self = HCObjectAllocate(sizeof(HCNumber));
     HCNumberValue v = { .integer = value };
     HCNumberInit(self, HCNumberValueTypeInteger, v);
     return self;
 }
 
 HCNumberRef HCNumberCreateWithReal(HCReal value) {
-    HCNumberRef self = calloc(sizeof(HCNumber), 1);
+    HCNumberRef self = HCObjectAllocate(sizeof(HCNumber));
     HCNumberValue v = { .real = value };
     HCNumberInit(self, HCNumberValueTypeReal, v);
     return self;
@@ -69,85 +105,132 @@ void HCNumberDestroy(HCNumberRef self) {
 // MARK: - Object Polymorphic Functions
 //----------------------------------------------------------------------------------------------------------------------------------
 HCBoolean HCNumberIsEqual(HCNumberRef self, HCNumberRef other) {
-    switch (self->type) {
+    HCNumberValueType selfType;
+    HCNumberValue selfValue;
+    HCNumberExtractValue(self, &selfType, &selfValue);
+    HCNumberValueType otherType;
+    HCNumberValue otherValue;
+    HCNumberExtractValue(other, &otherType, &otherValue);
+    switch (selfType) {
         case HCNumberValueTypeBoolean:
-            switch (other->type) {
-                case HCNumberValueTypeBoolean: return HCBooleanIsEqual(self->value.boolean, other->value.boolean);
-                case HCNumberValueTypeInteger: return !self->value.boolean ? (other->value.integer == 0) : (other->value.integer == 1);
-                case HCNumberValueTypeReal: return !self->value.boolean ? (other->value.real == 0.0) : (other->value.real == 1.0);
+            switch (otherType) {
+                case HCNumberValueTypeBoolean: return HCBooleanIsEqual(selfValue.boolean, otherValue.boolean);
+                case HCNumberValueTypeInteger: return !selfValue.boolean ? (otherValue.integer == 0) : (otherValue.integer == 1);
+                case HCNumberValueTypeReal: return !selfValue.boolean ? (otherValue.real == 0.0) : (otherValue.real == 1.0);
             }
         case HCNumberValueTypeInteger:
-            switch (other->type) {
-                case HCNumberValueTypeBoolean: return !other->value.boolean ? (self->value.integer == 0) : (self->value.integer == 1);
-                case HCNumberValueTypeInteger: return HCIntegerIsEqual(self->value.integer, other->value.integer);
-                case HCNumberValueTypeReal: return self->value.integer == (HCInteger)floor(other->value.real) && (HCInteger)floor(other->value.real) - other->value.real == 0;
+            switch (otherType) {
+                case HCNumberValueTypeBoolean: return !otherValue.boolean ? (selfValue.integer == 0) : (selfValue.integer == 1);
+                case HCNumberValueTypeInteger: return HCIntegerIsEqual(selfValue.integer, otherValue.integer);
+                case HCNumberValueTypeReal: return selfValue.integer == (HCInteger)floor(otherValue.real) && (HCInteger)floor(otherValue.real) - otherValue.real == 0;
             }
         case HCNumberValueTypeReal:
-            switch (other->type) {
-                case HCNumberValueTypeBoolean: return !other->value.boolean ? (self->value.real == 0.0) : (self->value.real == 1.0);
-                case HCNumberValueTypeInteger: return other->value.integer == (HCInteger)floor(self->value.real) && (HCInteger)floor(self->value.real) - self->value.real == 0;
-                case HCNumberValueTypeReal: return HCRealIsEqual(self->value.real, other->value.real);
+            switch (otherType) {
+                case HCNumberValueTypeBoolean: return !otherValue.boolean ? (selfValue.real == 0.0) : (selfValue.real == 1.0);
+                case HCNumberValueTypeInteger: return otherValue.integer == (HCInteger)floor(selfValue.real) && (HCInteger)floor(selfValue.real) - selfValue.real == 0;
+                case HCNumberValueTypeReal: return HCRealIsEqual(selfValue.real, otherValue.real);
             }
     }
     
-    return self->value.integer == other->value.integer;
+    return selfValue.integer == otherValue.integer;
 }
 
 HCInteger HCNumberHashValue(HCNumberRef self) {
-    switch (self->type) {
-        case HCNumberValueTypeBoolean: return HCBooleanHashValue(self->value.boolean);
-        case HCNumberValueTypeInteger: return HCIntegerHashValue(self->value.integer);
-        case HCNumberValueTypeReal: return HCRealHashValue(self->value.real);
+    HCNumberValueType type;
+    HCNumberValue value;
+    HCNumberExtractValue(self, &type, &value);
+    switch (type) {
+        case HCNumberValueTypeBoolean: return HCBooleanHashValue(value.boolean);
+        case HCNumberValueTypeInteger: return HCIntegerHashValue(value.integer);
+        case HCNumberValueTypeReal: return HCRealHashValue(value.real);
     }
-    return self->value.integer;
+    return value.integer;
 }
 
 void HCNumberPrint(HCNumberRef self, FILE* stream) {
-    switch (self->type) {
-        case HCNumberValueTypeBoolean: HCBooleanPrint(self->value.boolean, stream); break;
-        case HCNumberValueTypeInteger: HCIntegerPrint(self->value.integer, stream); break;
-        case HCNumberValueTypeReal: HCRealPrint(self->value.real, stream); break;
+    HCNumberValueType type;
+    HCNumberValue value;
+    HCNumberExtractValue(self, &type, &value);
+    switch (type) {
+        case HCNumberValueTypeBoolean: HCBooleanPrint(value.boolean, stream); break;
+        case HCNumberValueTypeInteger: HCIntegerPrint(value.integer, stream); break;
+        case HCNumberValueTypeReal: HCRealPrint(value.real, stream); break;
     }
 }
 
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Conversion
 //----------------------------------------------------------------------------------------------------------------------------------
+void HCNumberExtractValue(HCNumberRef self, HCNumberValueType* type, HCNumberValue* value) {
+    switch (HCObjectTagOf(self)) {
+        case HCObjectTagInteger:
+            *type = HCNumberValueTypeInteger;
+            *value = (HCNumberValue){ .integer = HCObjectTaggedPointerPayload(self) };
+            return;
+        case HCObjectTagBoolean:
+            *type = HCNumberValueTypeBoolean;
+            *value = (HCNumberValue){ .boolean = HCObjectTaggedPointerPayload(self) != 0 };
+            return;
+        default:
+            *type = self->type;
+            *value = self->value;
+            return;
+    }
+}
+
 HCBoolean HCNumberIsBoolean(HCNumberRef self) {
-    return self->type == HCNumberValueTypeBoolean;
+    HCNumberValueType type;
+    HCNumberValue value;
+    HCNumberExtractValue(self, &type, &value);
+    return type == HCNumberValueTypeBoolean;
 }
 
 HCBoolean HCNumberAsBoolean(HCNumberRef self) {
-    switch (self->type) {
-        case HCNumberValueTypeBoolean: return self->value.boolean;
-        case HCNumberValueTypeInteger: return self->value.integer != 0;
-        case HCNumberValueTypeReal: return self->value.real != 0.0;
+    HCNumberValueType type;
+    HCNumberValue value;
+    HCNumberExtractValue(self, &type, &value);
+    switch (type) {
+        case HCNumberValueTypeBoolean: return value.boolean;
+        case HCNumberValueTypeInteger: return value.integer != 0;
+        case HCNumberValueTypeReal: return value.real != 0.0;
     }
-    return self->value.boolean;
+    return value.boolean;
 }
 
 HCBoolean HCNumberIsInteger(HCNumberRef self) {
-    return self->type == HCNumberValueTypeInteger;
+    HCNumberValueType type;
+    HCNumberValue value;
+    HCNumberExtractValue(self, &type, &value);
+    return type == HCNumberValueTypeInteger;
 }
 
 HCInteger HCNumberAsInteger(HCNumberRef self) {
-    switch (self->type) {
-        case HCNumberValueTypeBoolean: return self->value.boolean == false ? 0 : 1;
-        case HCNumberValueTypeInteger: return self->value.integer;
-        case HCNumberValueTypeReal: return (HCInteger)floor(self->value.real);
+    HCNumberValueType type;
+    HCNumberValue value;
+    HCNumberExtractValue(self, &type, &value);
+    switch (type) {
+        case HCNumberValueTypeBoolean: return value.boolean == false ? 0 : 1;
+        case HCNumberValueTypeInteger: return value.integer;
+        case HCNumberValueTypeReal: return (HCInteger)floor(value.real);
     }
-    return self->value.integer;
+    return value.integer;
 }
 
 HCBoolean HCNumberIsReal(HCNumberRef self) {
-    return self->type == HCNumberValueTypeReal;
+    HCNumberValueType type;
+    HCNumberValue value;
+    HCNumberExtractValue(self, &type, &value);
+    return type == HCNumberValueTypeReal;
 }
 
 HCReal HCNumberAsReal(HCNumberRef self) {
-    switch (self->type) {
-        case HCNumberValueTypeBoolean: return self->value.boolean == false ? 0.0 : 1.0;
-        case HCNumberValueTypeInteger: return (HCReal)self->value.integer;
-        case HCNumberValueTypeReal: return self->value.real;
+    HCNumberValueType type;
+    HCNumberValue value;
+    HCNumberExtractValue(self, &type, &value);
+    switch (type) {
+        case HCNumberValueTypeBoolean: return value.boolean == false ? 0.0 : 1.0;
+        case HCNumberValueTypeInteger: return (HCReal)value.integer;
+        case HCNumberValueTypeReal: return value.real;
     }
-    return self->value.real;
+    return value.real;
 }
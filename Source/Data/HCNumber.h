@@ -34,12 +34,18 @@ typedef struct HCNumber* HCNumberRef;
 HCNumberRef HCNumberCreate(void);
 
 /// Creates a number containing a boolean value.
+///
+/// Boolean numbers are not allocated, so references to numbers with the same value may be identical.
+///
 /// @param value The boolean value the number should contain.
 /// @returns A reference to an @c HCNumber containing @c value.
 ///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
 HCNumberRef HCNumberCreateWithBoolean(HCBoolean value);
 
 /// Creates a number containing an integer value.
+///
+/// Integer numbers of small magnitude are not allocated, so references to numbers with the same value may be identical.
+///
 /// @param value The integer value the number should contain.
 /// @returns A reference to an @c HCNumber containing @c value.
 ///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
@@ -28,9 +28,14 @@ typedef union HCNumberValue {
     HCReal real;
 } HCNumberValue;
 
+#define HCNumberSingletonIntegerCountStatic (256)
+
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Object Type
 //----------------------------------------------------------------------------------------------------------------------------------
+// NOTE: Booleans and integers within the tagged integer range are encoded as tagged pointers rather than allocated.
+//       When tagged pointers are disabled, booleans and small integers are immortal singletons instead.
+//       Number functions must extract the value using HCNumberExtractValue() rather than accessing the fields directly.
 typedef struct HCNumber {
     HCObject base;
     HCNumberValueType type;
@@ -43,4 +48,9 @@ typedef struct HCNumber {
 void HCNumberInit(void* memory, HCNumberValueType type, HCNumberValue value);
 void HCNumberDestroy(HCNumberRef self);
 
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Conversion
+//----------------------------------------------------------------------------------------------------------------------------------
+void HCNumberExtractValue(HCNumberRef self, HCNumberValueType* type, HCNumberValue* value);
+
 #endif /* HCNumber_Internal_h */
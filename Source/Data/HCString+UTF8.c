@@ -0,0 +1,416 @@
+///
+/// @file HCString+UTF8.c
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#include "HCString_Internal.h"
+#include <string.h>
+
+// NOTE: The vector kernels are only built for x86-64 compilers supporting target attributes, where SSE2 is always available and AVX2 is detected at runtime
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define HCStringUTF8VectorStatic 1
+#include <immintrin.h>
+#else
+#define HCStringUTF8VectorStatic 0
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Dispatch
+//----------------------------------------------------------------------------------------------------------------------------------
+#if HCStringUTF8VectorStatic
+static _Atomic int HCStringUTF8SupportsAVX2 = -1;
+
+static inline HCBoolean HCStringUTF8UseAVX2(void) {
+    // Detect AVX2 support once
+    // NOTE: Racing threads detect and store the same value
+    int supportsAVX2 = atomic_load_explicit(&HCStringUTF8SupportsAVX2, memory_order_relaxed);
+    if (supportsAVX2 < 0) {
+        __builtin_cpu_init();
+        supportsAVX2 = __builtin_cpu_supports("avx2") ? 1 : 0;
+        atomic_store_explicit(&HCStringUTF8SupportsAVX2, supportsAVX2, memory_order_relaxed);
+    }
+    return supportsAVX2 == 1;
+}
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - ASCII Detection
+//----------------------------------------------------------------------------------------------------------------------------------
+HCBoolean HCStringCodeUnitsAreASCIIScalar(const HCStringCodeUnit* codeUnits, HCInteger count) {
+    // Test eight code units at a time for any set high bit, then test the remainder individually
+    HCInteger index = 0;
+    uint64_t bits = 0;
+    for (; index + 8 <= count; index += 8) {
+        uint64_t word;
+        memcpy(&word, codeUnits + index, sizeof(word));
+        bits |= word;
+    }
+    for (; index < count; index++) {
+        bits |= codeUnits[index];
+    }
+    return (bits & 0x8080808080808080ull) == 0;
+}
+
+#if HCStringUTF8VectorStatic
+__attribute__((target("avx2")))
+static HCBoolean HCStringCodeUnitsAreASCIIAVX2(const HCStringCodeUnit* codeUnits, HCInteger count) {
+    HCInteger index = 0;
+    __m256i bits = _mm256_setzero_si256();
+    for (; index + 32 <= count; index += 32) {
+        bits = _mm256_or_si256(bits, _mm256_loadu_si256((const __m256i*)(codeUnits + index)));
+    }
+    return _mm256_movemask_epi8(bits) == 0 && HCStringCodeUnitsAreASCIIScalar(codeUnits + index, count - index);
+}
+
+static HCBoolean HCStringCodeUnitsAreASCIISSE2(const HCStringCodeUnit* codeUnits, HCInteger count) {
+    HCInteger index = 0;
+    __m128i bits = _mm_setzero_si128();
+    for (; index + 16 <= count; index += 16) {
+        bits = _mm_or_si128(bits, _mm_loadu_si128((const __m128i*)(codeUnits + index)));
+    }
+    return _mm_movemask_epi8(bits) == 0 && HCStringCodeUnitsAreASCIIScalar(codeUnits + index, count - index);
+}
+#endif
+
+HCBoolean HCStringCodeUnitsAreASCII(const HCStringCodeUnit* codeUnits, HCInteger count) {
+#if HCStringUTF8VectorStatic
+    return HCStringUTF8UseAVX2() ? HCStringCodeUnitsAreASCIIAVX2(codeUnits, count) : HCStringCodeUnitsAreASCIISSE2(codeUnits, count);
+#else
+    return HCStringCodeUnitsAreASCIIScalar(codeUnits, count);
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Validation
+//----------------------------------------------------------------------------------------------------------------------------------
+HCBoolean HCStringCodeUnitsAreValidScalar(const HCStringCodeUnit* codeUnits, HCInteger count) {
+    HCInteger index = 0;
+    while (index < count) {
+        // Skip runs of ASCII code units eight at a time
+        if (index + 8 <= count) {
+            uint64_t word;
+            memcpy(&word, codeUnits + index, sizeof(word));
+            if ((word & 0x8080808080808080ull) == 0) {
+                index += 8;
+                continue;
+            }
+        }
+        if (codeUnits[index] < 0x80) {
+            index++;
+            continue;
+        }
+
+        // Validate the multi-byte sequence implied by the lead code unit
+        HCStringCodeUnit lead = codeUnits[index];
+        HCInteger sequenceCount = lead >= 0xF0 ? 4 : (lead >= 0xE0 ? 3 : (lead >= 0xC0 ? 2 : 1));
+        if (index + sequenceCount > count || !HCStringCodeUnitSequeceIsValid(codeUnits + index, sequenceCount)) {
+            return false;
+        }
+        index += sequenceCount;
+    }
+    return true;
+}
+
+#if HCStringUTF8VectorStatic
+// NOTE: The AVX2 validation follows the lookup algorithm of Keiser and Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte" (2021)
+//       Each byte pair is classified by three 16-entry tables, whose bitwise and is non-zero exactly when the pair is an error, except for
+//       missing or excess third and fourth continuation bytes, which are found by comparing against the bytes two and three positions back
+#define HCStringUTF8TooShort        (1 << 0)
+#define HCStringUTF8TooLong         (1 << 1)
+#define HCStringUTF8Overlong3       (1 << 2)
+#define HCStringUTF8TooLarge        (1 << 3)
+#define HCStringUTF8Surrogate       (1 << 4)
+#define HCStringUTF8Overlong2       (1 << 5)
+#define HCStringUTF8TooLarge1000    (1 << 6)
+#define HCStringUTF8Overlong4       (1 << 6)
+#define HCStringUTF8TwoContinuations (1 << 7)
+#define HCStringUTF8Carry           (HCStringUTF8TooShort | HCStringUTF8TooLong | HCStringUTF8TwoContinuations)
+
+__attribute__((target("avx2")))
+static inline __m256i HCStringUTF8Lookup(__m256i indices, const int8_t* table) {
+    __m256i lookup = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)table));
+    return _mm256_shuffle_epi8(lookup, indices);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i HCStringUTF8BlockErrors(__m256i input, __m256i previousInput) {
+    static const int8_t firstHigh[16] = {
+        // 0_______ ________ <ASCII in byte 1>
+        HCStringUTF8TooLong, HCStringUTF8TooLong, HCStringUTF8TooLong, HCStringUTF8TooLong,
+        HCStringUTF8TooLong, HCStringUTF8TooLong, HCStringUTF8TooLong, HCStringUTF8TooLong,
+        // 10______ ________ <continuation in byte 1>
+        (int8_t)HCStringUTF8TwoContinuations, (int8_t)HCStringUTF8TwoContinuations, (int8_t)HCStringUTF8TwoContinuations, (int8_t)HCStringUTF8TwoContinuations,
+        // 1100____ ________ <two byte lead in byte 1>
+        HCStringUTF8TooShort | HCStringUTF8Overlong2,
+        // 1101____ ________ <two byte lead in byte 1>
+        HCStringUTF8TooShort,
+        // 1110____ ________ <three byte lead in byte 1>
+        HCStringUTF8TooShort | HCStringUTF8Overlong3 | HCStringUTF8Surrogate,
+        // 1111____ ________ <four+ byte lead in byte 1>
+        HCStringUTF8TooShort | HCStringUTF8TooLarge | HCStringUTF8TooLarge1000 | HCStringUTF8Overlong4,
+    };
+    static const int8_t firstLow[16] = {
+        // ____0000 ________
+        (int8_t)(HCStringUTF8Carry | HCStringUTF8Overlong3 | HCStringUTF8Overlong2 | HCStringUTF8Overlong4),
+        // ____0001 ________
+        (int8_t)(HCStringUTF8Carry | HCStringUTF8Overlong2),
+        // ____001_ ________
+        (int8_t)HCStringUTF8Carry,
+        (int8_t)HCStringUTF8Carry,
+        // ____0100 ________
+        (int8_t)(HCStringUTF8Carry | HCStringUTF8TooLarge),
+        // ____0101 ________
+        (int8_t)(HCStringUTF8Carry | HCStringUTF8TooLarge | HCStringUTF8TooLarge1000),
+        // ____011_ ________
+        (int8_t)(HCStringUTF8Carry | HCStringUTF8TooLarge | HCStringUTF8TooLarge1000),
+        (int8_t)(HCStringUTF8Carry | HCStringUTF8TooLarge | HCStringUTF8TooLarge1000),
+        // ____1___ ________
+        (int8_t)(HCStringUTF8Carry | HCStringUTF8TooLarge | HCStringUTF8TooLarge1000),
+        (int8_t)(HCStringUTF8Carry | HCStringUTF8TooLarge | HCStringUTF8TooLarge1000),
+        (int8_t)(HCStringUTF8Carry | HCStringUTF8TooLarge | HCStringUTF8TooLarge1000),
+        (int8_t)(HCStringUTF8Carry | HCStringUTF8TooLarge | HCStringUTF8TooLarge1000),
+        (int8_t)(HCStringUTF8Carry | HCStringUTF8TooLarge | HCStringUTF8TooLarge1000),
+        // ____1101 ________
+        (int8_t)(HCStringUTF8Carry | HCStringUTF8TooLarge | HCStringUTF8TooLarge1000 | HCStringUTF8Surrogate),
+        (int8_t)(HCStringUTF8Carry | HCStringUTF8TooLarge | HCStringUTF8TooLarge1000),
+        (int8_t)(HCStringUTF8Carry | HCStringUTF8TooLarge | HCStringUTF8TooLarge1000),
+    };
+    static const int8_t secondHigh[16] = {
+        // ________ 0_______ <ASCII in byte 2>
+        HCStringUTF8TooShort, HCStringUTF8TooShort, HCStringUTF8TooShort, HCStringUTF8TooShort,
+        HCStringUTF8TooShort, HCStringUTF8TooShort, HCStringUTF8TooShort, HCStringUTF8TooShort,
+        // ________ 1000____
+        (int8_t)(HCStringUTF8TooLong | HCStringUTF8Overlong2 | HCStringUTF8TwoContinuations | HCStringUTF8Overlong3 | HCStringUTF8TooLarge1000 | HCStringUTF8Overlong4),
+        // ________ 1001____
+        (int8_t)(HCStringUTF8TooLong | HCStringUTF8Overlong2 | HCStringUTF8TwoContinuations | HCStringUTF8Overlong3 | HCStringUTF8TooLarge),
+        // ________ 101_____
+        (int8_t)(HCStringUTF8TooLong | HCStringUTF8Overlong2 | HCStringUTF8TwoContinuations | HCStringUTF8Surrogate | HCStringUTF8TooLarge),
+        (int8_t)(HCStringUTF8TooLong | HCStringUTF8Overlong2 | HCStringUTF8TwoContinuations | HCStringUTF8Surrogate | HCStringUTF8TooLarge),
+        // ________ 11______
+        HCStringUTF8TooShort, HCStringUTF8TooShort, HCStringUTF8TooShort, HCStringUTF8TooShort,
+    };
+
+    // Obtain the bytes one, two, and three positions before each byte of the input, reaching into the previous input
+    __m256i previousHalves = _mm256_permute2x128_si256(previousInput, input, 0x21);
+    __m256i previous1 = _mm256_alignr_epi8(input, previousHalves, 16 - 1);
+    __m256i previous2 = _mm256_alignr_epi8(input, previousHalves, 16 - 2);
+    __m256i previous3 = _mm256_alignr_epi8(input, previousHalves, 16 - 3);
+
+    // Classify each pair of bytes
+    __m256i lowNibbleMask = _mm256_set1_epi8(0x0F);
+    __m256i previous1High = _mm256_and_si256(_mm256_srli_epi16(previous1, 4), lowNibbleMask);
+    __m256i previous1Low = _mm256_and_si256(previous1, lowNibbleMask);
+    __m256i inputHigh = _mm256_and_si256(_mm256_srli_epi16(input, 4), lowNibbleMask);
+    __m256i specialCases = _mm256_and_si256(_mm256_and_si256(HCStringUTF8Lookup(previous1High, firstHigh), HCStringUTF8Lookup(previous1Low, firstLow)), HCStringUTF8Lookup(inputHigh, secondHigh));
+
+    // Third and fourth bytes of a sequence must be continuations, which the two continuations case flags, and no other byte may be
+    __m256i isThirdByte = _mm256_subs_epu8(previous2, _mm256_set1_epi8((char)(0xE0 - 0x80)));
+    __m256i isFourthByte = _mm256_subs_epu8(previous3, _mm256_set1_epi8((char)(0xF0 - 0x80)));
+    __m256i mustBeContinuation = _mm256_and_si256(_mm256_or_si256(isThirdByte, isFourthByte), _mm256_set1_epi8((char)0x80));
+    return _mm256_xor_si256(mustBeContinuation, specialCases);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i HCStringUTF8BlockIncomplete(__m256i input) {
+    // The last three bytes of a block must not begin sequences longer than the bytes remaining in the block
+    __m256i maximum = _mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+    return _mm256_subs_epu8(input, maximum);
+}
+
+__attribute__((target("avx2")))
+static HCBoolean HCStringCodeUnitsAreValidAVX2(const HCStringCodeUnit* codeUnits, HCInteger count) {
+    __m256i error = _mm256_setzero_si256();
+    __m256i previousInput = _mm256_setzero_si256();
+    __m256i previousIncomplete = _mm256_setzero_si256();
+    HCInteger index = 0;
+    for (; index + 32 <= count; index += 32) {
+        // Blocks of ASCII only need to check that the previous block did not end mid-sequence
+        __m256i input = _mm256_loadu_si256((const __m256i*)(codeUnits + index));
+        if (_mm256_movemask_epi8(input) == 0) {
+            error = _mm256_or_si256(error, previousIncomplete);
+        }
+        else {
+            error = _mm256_or_si256(error, HCStringUTF8BlockErrors(input, previousInput));
+        }
+        previousIncomplete = HCStringUTF8BlockIncomplete(input);
+        previousInput = input;
+    }
+
+    // Check the fewer than 32 remaining code units padded with ASCII zeroes
+    // NOTE: At least one zero follows the code units, which reveals any sequence left incomplete at the end
+    HCStringCodeUnit padded[32] = { 0 };
+    memcpy(padded, codeUnits + index, count - index);
+    __m256i input = _mm256_loadu_si256((const __m256i*)padded);
+    error = _mm256_or_si256(error, HCStringUTF8BlockErrors(input, previousInput));
+    return _mm256_testz_si256(error, error);
+}
+
+static HCBoolean HCStringCodeUnitsAreValidSSE2(const HCStringCodeUnit* codeUnits, HCInteger count) {
+    // Skip blocks of ASCII, validating other code units individually from the start of the first block containing them
+    // NOTE: SSE2 has no byte shuffle with which to classify code units, and sequences may not start within the skipped blocks
+    HCInteger index = 0;
+    while (index + 16 <= count) {
+        if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(codeUnits + index))) == 0) {
+            index += 16;
+            continue;
+        }
+
+        // Validate until reaching the end of a sequence at or beyond the end of the block
+        HCInteger blockEnd = index + 16;
+        while (index < blockEnd) {
+            HCStringCodeUnit lead = codeUnits[index];
+            HCInteger sequenceCount = lead < 0x80 ? 1 : (lead >= 0xF0 ? 4 : (lead >= 0xE0 ? 3 : (lead >= 0xC0 ? 2 : 1)));
+            if (lead >= 0x80 && (index + sequenceCount > count || !HCStringCodeUnitSequeceIsValid(codeUnits + index, sequenceCount))) {
+                return false;
+            }
+            index += sequenceCount;
+        }
+    }
+    return HCStringCodeUnitsAreValidScalar(codeUnits + index, count - index);
+}
+#endif
+
+HCBoolean HCStringCodeUnitsAreValid(const HCStringCodeUnit* codeUnits, HCInteger count) {
+#if HCStringUTF8VectorStatic
+    return HCStringUTF8UseAVX2() ? HCStringCodeUnitsAreValidAVX2(codeUnits, count) : HCStringCodeUnitsAreValidSSE2(codeUnits, count);
+#else
+    return HCStringCodeUnitsAreValidScalar(codeUnits, count);
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Code Point Indexing
+//----------------------------------------------------------------------------------------------------------------------------------
+// NOTE: In valid UTF-8, every code unit that is not a continuation (10______) begins a code point
+//       Lead code units are gathered into bit masks, and at most one checkpoint can fall within the bits of a mask
+static inline HCInteger HCStringIndexLeadMask(uint32_t leadMask, HCInteger offset, HCInteger codePointIndex, HCInteger* checkpoints) {
+    // Find the checkpoint falling within the mask, if any, as the lead at the rank of the checkpoint within the mask
+    HCInteger leadCount = __builtin_popcount(leadMask);
+    HCInteger checkpointRank = (HCStringCodePointCheckpointIntervalStatic - codePointIndex % HCStringCodePointCheckpointIntervalStatic) % HCStringCodePointCheckpointIntervalStatic;
+    if (checkpointRank < leadCount) {
+        for (HCInteger rank = 0; rank < checkpointRank; rank++) {
+            leadMask &= leadMask - 1;
+        }
+        checkpoints[(codePointIndex + checkpointRank) / HCStringCodePointCheckpointIntervalStatic] = offset + __builtin_ctz(leadMask);
+    }
+    return codePointIndex + leadCount;
+}
+
+HCInteger HCStringIndexCodePointsScalar(const HCStringCodeUnit* codeUnits, HCInteger count, HCInteger* checkpoints) {
+    HCInteger codePointIndex = 0;
+    for (HCInteger index = 0; index < count; index++) {
+        if ((codeUnits[index] & 0xC0) != 0x80) {
+            if (codePointIndex % HCStringCodePointCheckpointIntervalStatic == 0) {
+                checkpoints[codePointIndex / HCStringCodePointCheckpointIntervalStatic] = index;
+            }
+            codePointIndex++;
+        }
+    }
+    return codePointIndex;
+}
+
+#if HCStringUTF8VectorStatic
+__attribute__((target("avx2,popcnt,bmi")))
+static HCInteger HCStringIndexCodePointsAVX2(const HCStringCodeUnit* codeUnits, HCInteger count, HCInteger* checkpoints) {
+    // Continuation code units are exactly those less than or equal to 0xBF when compared as signed bytes
+    HCInteger codePointIndex = 0;
+    HCInteger index = 0;
+    __m256i continuationMaximum = _mm256_set1_epi8((char)0xBF);
+    for (; index + 32 <= count; index += 32) {
+        __m256i input = _mm256_loadu_si256((const __m256i*)(codeUnits + index));
+        uint32_t leadMask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpgt_epi8(input, continuationMaximum));
+        codePointIndex = HCStringIndexLeadMask(leadMask, index, codePointIndex, checkpoints);
+    }
+    for (; index < count; index++) {
+        if ((codeUnits[index] & 0xC0) != 0x80) {
+            codePointIndex = HCStringIndexLeadMask(1, index, codePointIndex, checkpoints);
+        }
+    }
+    return codePointIndex;
+}
+
+static HCInteger HCStringIndexCodePointsSSE2(const HCStringCodeUnit* codeUnits, HCInteger count, HCInteger* checkpoints) {
+    HCInteger codePointIndex = 0;
+    HCInteger index = 0;
+    __m128i continuationMaximum = _mm_set1_epi8((char)0xBF);
+    for (; index + 16 <= count; index += 16) {
+        __m128i input = _mm_loadu_si128((const __m128i*)(codeUnits + index));
+        uint32_t leadMask = (uint32_t)_mm_movemask_epi8(_mm_cmpgt_epi8(input, continuationMaximum));
+        codePointIndex = HCStringIndexLeadMask(leadMask, index, codePointIndex, checkpoints);
+    }
+    for (; index < count; index++) {
+        if ((codeUnits[index] & 0xC0) != 0x80) {
+            codePointIndex = HCStringIndexLeadMask(1, index, codePointIndex, checkpoints);
+        }
+    }
+    return codePointIndex;
+}
+#endif
+
+HCInteger HCStringIndexCodePoints(const HCStringCodeUnit* codeUnits, HCInteger count, HCInteger* checkpoints) {
+#if HCStringUTF8VectorStatic
+    return HCStringUTF8UseAVX2() ? HCStringIndexCodePointsAVX2(codeUnits, count, checkpoints) : HCStringIndexCodePointsSSE2(codeUnits, count, checkpoints);
+#else
+    return HCStringIndexCodePointsScalar(codeUnits, count, checkpoints);
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Transcoding
+//----------------------------------------------------------------------------------------------------------------------------------
+HCInteger HCStringConvertASCIICodeUnitsScalar(const HCStringCodeUnit* source, HCInteger count, HCStringCodePoint* target) {
+    HCInteger index = 0;
+    for (; index < count && source[index] < 0x80; index++) {
+        target[index] = source[index];
+    }
+    return index;
+}
+
+#if HCStringUTF8VectorStatic
+__attribute__((target("avx2")))
+static HCInteger HCStringConvertASCIICodeUnitsAVX2(const HCStringCodeUnit* source, HCInteger count, HCStringCodePoint* target) {
+    // Widen blocks of sixteen ASCII code units to code points, stopping at the first block containing other code units
+    HCInteger index = 0;
+    for (; index + 16 <= count; index += 16) {
+        __m128i input = _mm_loadu_si128((const __m128i*)(source + index));
+        if (_mm_movemask_epi8(input) != 0) {
+            break;
+        }
+        _mm256_storeu_si256((__m256i*)(target + index), _mm256_cvtepu8_epi32(input));
+        _mm256_storeu_si256((__m256i*)(target + index + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(input, 8)));
+    }
+    return index + HCStringConvertASCIICodeUnitsScalar(source + index, count - index, target + index);
+}
+
+static HCInteger HCStringConvertASCIICodeUnitsSSE2(const HCStringCodeUnit* source, HCInteger count, HCStringCodePoint* target) {
+    HCInteger index = 0;
+    __m128i zero = _mm_setzero_si128();
+    for (; index + 16 <= count; index += 16) {
+        __m128i input = _mm_loadu_si128((const __m128i*)(source + index));
+        if (_mm_movemask_epi8(input) != 0) {
+            break;
+        }
+        __m128i low = _mm_unpacklo_epi8(input, zero);
+        __m128i high = _mm_unpackhi_epi8(input, zero);
+        _mm_storeu_si128((__m128i*)(target + index), _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128((__m128i*)(target + index + 4), _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128((__m128i*)(target + index + 8), _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128((__m128i*)(target + index + 12), _mm_unpackhi_epi16(high, zero));
+    }
+    return index + HCStringConvertASCIICodeUnitsScalar(source + index, count - index, target + index);
+}
+#endif
+
+HCInteger HCStringConvertASCIICodeUnits(const HCStringCodeUnit* source, HCInteger count, HCStringCodePoint* target) {
+#if HCStringUTF8VectorStatic
+    return HCStringUTF8UseAVX2() ? HCStringConvertASCIICodeUnitsAVX2(source, count, target) : HCStringConvertASCIICodeUnitsSSE2(source, count, target);
+#else
+    return HCStringConvertASCIICodeUnitsScalar(source, count, target);
+#endif
+}
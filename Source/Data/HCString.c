@@ -8,6 +8,9 @@
 ///
 
 #include "HCString_Internal.h"
+#include "../Core/HCArena_Internal.h"
+#include "../Container/HCSet.h"
+#include <pthread.h>
 #include <inttypes.h>
 #include <string.h>
 #include <float.h>
@@ -20,6 +23,8 @@ const HCObjectTypeData HCStringTypeDataInstance = {
     .base = {
         .ancestor = &HCObjectTypeDataInstance.base,
         .name = "HCString",
+        .identifier = HCTypeIdentifierString,
+        .kindMask = HCTypeKindMaskForIdentifier(HCTypeIdentifierObject) | HCTypeKindMaskForIdentifier(HCTypeIdentifierString),
     },
     .isEqual = (void*)HCStringIsEqual,
     .hashValue = (void*)HCStringHashValue,
@@ -68,7 +73,7 @@ static const char* HCStringTrueBooleans[] = {
 // MARK: - Construction
 //----------------------------------------------------------------------------------------------------------------------------------
 HCStringRef HCStringCreate(void) {
-    HCStringRef self = calloc(sizeof(HCString), 1);
+    HCStringRef self = HCStringAllocate(0);
     HCStringInit(self, 0, NULL);
     return self;
 }
@@ -83,7 +88,7 @@ HCStringRef HCStringCreateWithBytes(HCStringEncoding encoding, HCInteger size, c
     }
     
     // Initialize the string object with the code unit data
-    HCStringRef self = calloc(sizeof(HCString), 1);
+    HCStringRef self = HCStringAllocate(size);
     HCStringInit(self, size, codeUnits);
     return self;
 }
@@ -95,46 +100,52 @@ HCStringRef HCStringCreateWithCString(const char* value) {
 }
 
 HCStringRef HCStringCreateWithBoolean(HCBoolean value) {
-    HCStringRef self = calloc(sizeof(HCString), 1);
     // TODO: What string values should be used to represent true and false? "true" & "false"? "1" & "0"? "t" & "f"? "⊨" & "⊭"?
     const char* stringValue = value ? "⊨" : "⊭";
+    HCStringRef self = HCStringAllocate(strlen(stringValue));
     HCStringInit(self, strlen(stringValue), (HCStringCodeUnit*)stringValue);
     return self;
 }
 
 HCStringRef HCStringCreateWithInteger(HCInteger value) {
-    // Determine the length of the printed integer value, allocate memory to store it, and print the integer value
+    // Determine the length of the printed integer value, allocate the string with storage for it, and print the integer value in place
     ssize_t length = snprintf(NULL, 0, "%" PRIi64, value);
-    char* string = malloc(length + 1);
-    snprintf(string, length + 1, "%" PRIi64, value);
+    HCStringRef self = HCStringAllocate(length);
+    snprintf((char*)self->inlineCodeUnits, length + 1, "%" PRIi64, value);
     
     // Initialize the string object with the integer string
-    HCStringRef self = calloc(sizeof(HCString), 1);
-    HCStringInitWithoutCopying(self, length, (HCStringCodeUnit*)string);
+    HCStringInitWithoutCopying(self, length, self->inlineCodeUnits);
     return self;
 }
 
 HCStringRef HCStringCreateWithReal(HCReal value) {
-    // Determine the length of the printed real value, allocate memory to store it, and print the real value
+    // Determine the length of the printed real value, allocate the string with storage for it, and print the real value in place
     ssize_t length = snprintf(NULL, 0, "%.17g", value);
-    char* string = malloc(length + 1);
-    snprintf(string, length + 1, "%.17g", value);
+    HCStringRef self = HCStringAllocate(length);
+    snprintf((char*)self->inlineCodeUnits, length + 1, "%.17g", value);
     
     // Initialize the string object with the real value string
-    HCStringRef self = calloc(sizeof(HCString), 1);
-    HCStringInitWithoutCopying(self, length, (HCStringCodeUnit*)string);
+    HCStringInitWithoutCopying(self, length, self->inlineCodeUnits);
     return self;
 }
 
+HCStringRef HCStringAllocate(HCInteger codeUnitCount) {
+    // Allocate the string object together with storage for its code units and a null terminating character
+    // TODO: Check that the allocation proceeded successfully, determine how to pass the error otherwise
+    return HCObjectAllocate(sizeof(HCString) + (codeUnitCount + 1) * sizeof(HCStringCodeUnit));
+}
+
 void HCStringInit(void* memory, HCInteger codeUnitCount, HCStringCodeUnit* codeUnits) {
-    // Copy the passed code units, ensuring a null terminating character follows them, allowing for ease use as a C string
-    // TODO: Check that the allocation and copy proceed successfully, determine how to pass the error otherwise
-    HCStringCodeUnit* copiedCodeUnits = malloc(codeUnitCount + 1 * sizeof(HCStringCodeUnit));
-    memcpy(copiedCodeUnits, codeUnits, codeUnitCount * sizeof(HCStringCodeUnit));
-    copiedCodeUnits[codeUnitCount] = '\0';
+    // Copy the passed code units to the inline storage, ensuring a null terminating character follows them, allowing for ease use as a C string
+    // NOTE: The memory must have been allocated using HCStringAllocate() with at least codeUnitCount code units
+    HCStringRef self = memory;
+    if (codeUnitCount > 0) {
+        memcpy(self->inlineCodeUnits, codeUnits, codeUnitCount * sizeof(HCStringCodeUnit));
+    }
+    self->inlineCodeUnits[codeUnitCount] = '\0';
     
     // Initialize the string object with the copied code units
-    HCStringInitWithoutCopying(memory, codeUnitCount, copiedCodeUnits);
+    HCStringInitWithoutCopying(memory, codeUnitCount, self->inlineCodeUnits);
 }
 
 void HCStringInitWithoutCopying(void* memory, HCInteger codeUnitCount, HCStringCodeUnit* codeUnits) {
@@ -145,27 +156,99 @@ void HCStringInitWithoutCopying(void* memory, HCInteger codeUnitCount, HCStringC
     self->base.type = HCStringType;
     self->codeUnitCount = codeUnitCount;
     self->codeUnits = codeUnits;
+    self->hashValue = 0;
+    self->isInterned = false;
+    
+    // Determine if the string contains only ASCII code units, in which case each code unit is a code point
+    // NOTE: The code point index of other strings is built on first use of their code points
+    HCBoolean isASCII = HCStringCodeUnitsAreASCII(codeUnits, codeUnitCount);
+    self->isASCII = isASCII;
+    self->codePointCount = isASCII ? codeUnitCount : -1;
+    self->codePointCheckpoints = NULL;
+}
+
+void HCStringInitBorrowingCString(void* memory, const char* value) {
+    // Initialize a string object that refers to the null-terminated string in place, typically in stack memory
+    // NOTE: The string object must not be retained or released, and must not be used after the null-terminated string is invalidated
+    // NOTE: The memory must be zeroed, since HCObjectInit() reads the size class HCObjectAllocate() records in allocated objects
+    HCStringInitWithoutCopying(memory, strlen(value), (HCStringCodeUnit*)value);
 }
 
 void HCStringDestroy(HCStringRef self) {
-    free(self->codeUnits);
+    free(atomic_load_explicit(&self->codePointCheckpoints, memory_order_relaxed));
+    if (self->codeUnits != self->inlineCodeUnits) {
+        free(self->codeUnits);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Interning
+//----------------------------------------------------------------------------------------------------------------------------------
+// NOTE: The intern table is created on first use and retains every interned string for the lifetime of the process
+static pthread_mutex_t HCStringInternTableLock = PTHREAD_MUTEX_INITIALIZER;
+static HCSetRef HCStringInternTable = NULL;
+
+HCStringRef HCStringCreateInterned(HCStringRef string) {
+    if (string->isInterned) {
+        return HCRetain(string);
+    }
+    
+    // Find the interned string equal to the string, or intern a copy of the string
+    // NOTE: The table and interned strings outlive any arena and are used by all threads, so they are created outside of any arena and shared
+    pthread_mutex_lock(&HCStringInternTableLock);
+    if (HCStringInternTable == NULL) {
+        HCArenaRef previous = HCArenaBeginCreatingObjects(NULL);
+        HCStringInternTable = HCSetCreate();
+        HCArenaEndCreatingObjects(previous);
+        HCObjectMarkShared(HCStringInternTable);
+    }
+    HCStringRef interned = HCSetObjectEqualToObject(HCStringInternTable, string);
+    if (interned == NULL) {
+        HCArenaRef previous = HCArenaBeginCreatingObjects(NULL);
+        interned = HCStringAllocate(string->codeUnitCount);
+        HCArenaEndCreatingObjects(previous);
+        HCStringInit(interned, string->codeUnitCount, string->codeUnits);
+        HCObjectMarkShared(interned);
+        interned->isInterned = true;
+        HCSetAddObjectReleased(HCStringInternTable, interned);
+    }
+    HCRetain(interned);
+    pthread_mutex_unlock(&HCStringInternTableLock);
+    return interned;
+}
+
+HCStringRef HCStringCreateInternedWithCString(const char* value) {
+    HCString string = {0};
+    HCStringInitBorrowingCString(&string, value);
+    return HCStringCreateInterned(&string);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Object Polymorphic Functions
 //----------------------------------------------------------------------------------------------------------------------------------
 HCBoolean HCStringIsEqual(HCStringRef self, HCStringRef other) {
+    // Interned strings are unique for their code units, so they are only equal to themselves
+    if (self == other) {
+        return true;
+    }
+    if (self->isInterned && other->isInterned) {
+        return false;
+    }
+    
     // TODO: This does not comply with the rules of Unicode string equivalence for e.g. constructions of equivalent glyphs using combinational code points.
     return HCStringContainsSameCodeUnits(self, other);
 }
 
 HCInteger HCStringHashValue(HCStringRef self) {
-    HCInteger hash = 5381;
-    for (HCInteger codeUnitIndex = 0; codeUnitIndex < self->codeUnitCount; codeUnitIndex++) {
-        HCStringCodeUnit c = self->codeUnits[codeUnitIndex];
-        hash = ((hash << 5) + hash) + c;
+    // Hash the code units once and cache the result, since strings are immutable
+    // NOTE: A zero value marks the hash as not yet computed, so a string hashing to zero is hashed on each call
+    // NOTE: Threads computing the hash at the same time store the same value, so relaxed atomic access is sufficient
+    HCInteger hashValue = atomic_load_explicit(&self->hashValue, memory_order_relaxed);
+    if (hashValue == 0) {
+        hashValue = HCBytesHashValue(self->codeUnitCount * sizeof(HCStringCodeUnit), (const HCByte*)self->codeUnits);
+        atomic_store_explicit(&self->hashValue, hashValue, memory_order_relaxed);
     }
-    return hash;
+    return hashValue;
 }
 
 void HCStringPrint(HCStringRef self, FILE* stream) {
@@ -179,6 +262,10 @@ HCBoolean HCStringIsEmpty(HCStringRef self) {
     return self->codeUnitCount == 0;
 }
 
+HCBoolean HCStringIsInterned(HCStringRef self) {
+    return self->isInterned;
+}
+
 HCInteger HCStringCodeUnitCount(HCStringRef self) {
     return self->codeUnitCount;
 }
@@ -192,10 +279,12 @@ void HCStringExtractCodeUnits(HCStringRef self, HCInteger codeUnitIndex, HCInteg
 }
 
 HCInteger HCStringCodePointCount(HCStringRef self) {
-    HCInteger size = 0;
-    HCStringCodePoint* end = (HCStringCodePoint*)(-1);
-    HCStringConvertCodeUnits(self, NULL, NULL, (HCStringCodePoint**)&size, end);
-    return (HCInteger)(size) / sizeof(HCStringCodePoint);
+    // NOTE: Acquiring the count also acquires the code point index published before it
+    HCInteger codePointCount = atomic_load_explicit(&self->codePointCount, memory_order_acquire);
+    if (codePointCount < 0) {
+        codePointCount = HCStringBuildCodePointIndex(self);
+    }
+    return codePointCount;
 }
 
 HCStringCodePoint HCStringCodePointAtIndex(HCStringRef self, HCInteger codePointIndex) {
@@ -206,21 +295,32 @@ HCStringCodePoint HCStringCodePointAtIndex(HCStringRef self, HCInteger codePoint
 }
 
 void HCStringExtractCodePoints(HCStringRef self, HCInteger codePointIndex, HCInteger count, HCStringCodePoint* destination) {
-    // Walk to the requested code point index
-    HCInteger start = 0;
-    HCInteger end = sizeof(HCStringCodePoint) * codePointIndex;
-    HCStringCodeUnit* codeUnitIndex = self->codeUnits;
-    HCStringConvertCodeUnits(self, &codeUnitIndex, NULL, (HCStringCodePoint**)&start, (HCStringCodePoint*)end);
-    if (codeUnitIndex >= self->codeUnits + self->codeUnitCount) {
+    if (codePointIndex < 0 || codePointIndex >= HCStringCodePointCount(self)) {
         return;
     }
     
-    // Convert code points until the count is reached, or the source is exausted
+    // Copy ASCII code units directly, since each is a code point
     HCStringCodePoint* codePoints = destination;
-    HCStringConvertCodeUnits(self, &codeUnitIndex, NULL, &codePoints, codePoints + count);
+    if (self->isASCII) {
+        HCInteger copyCount = count < self->codeUnitCount - codePointIndex ? count : self->codeUnitCount - codePointIndex;
+        for (HCInteger index = 0; index < copyCount; index++) {
+            *codePoints++ = self->codeUnits[codePointIndex + index];
+        }
+    }
+    else {
+        // Start from the nearest preceding checkpoint, and walk to the requested code point index
+        HCInteger* checkpoints = atomic_load_explicit(&self->codePointCheckpoints, memory_order_acquire);
+        HCStringCodeUnit* codeUnitIndex = self->codeUnits + checkpoints[codePointIndex / HCStringCodePointCheckpointIntervalStatic];
+        HCStringCodePoint skipped[HCStringCodePointCheckpointIntervalStatic];
+        HCStringCodePoint* skippedEnd = skipped;
+        HCStringConvertCodeUnits(self, &codeUnitIndex, NULL, &skippedEnd, skipped + codePointIndex % HCStringCodePointCheckpointIntervalStatic);
+        
+        // Convert code points until the count is reached, or the source is exausted
+        HCStringConvertCodeUnits(self, &codeUnitIndex, NULL, &codePoints, codePoints + count);
+    }
     
     // Fill any remaining memory in the destination
-    for (; codePoints < destination; codePoints++) {
+    for (; codePoints < destination + count; codePoints++) {
         *codePoints = HCStringCodePointReplacement;
     }
 }
@@ -237,10 +337,11 @@ HCBoolean HCStringCodeUnitSequeceIsValid(const HCStringCodeUnit* source, HCInteg
         case 3: if ((a = (*--c)) < 0x80 || a > 0xBF) return false; // Fallthrough on true
         case 2: if ((a = (*--c)) > 0xBF) return false; // Fallthrough on true
         switch (*source) {
-            case 0xE0: if (a < 0xA0) return false;
-            case 0xED: if (a > 0x9F) return false;
-            case 0xF0: if (a < 0x90) return false;
-            case 0xF4: if (a > 0x8F) return false;
+            // No fallthrough in this inner switch
+            case 0xE0: if (a < 0xA0) return false; break;
+            case 0xED: if (a < 0x80 || a > 0x9F) return false; break;
+            case 0xF0: if (a < 0x90) return false; break;
+            case 0xF4: if (a < 0x80 || a > 0x8F) return false; break;
             default:   if (a < 0x80) return false;
         }
         case 1: if (*source >= 0x80 && *source < 0xC2) return false;
@@ -249,6 +350,41 @@ HCBoolean HCStringCodeUnitSequeceIsValid(const HCStringCodeUnit* source, HCInteg
     return true;
 }
 
+HCInteger HCStringBuildCodePointIndex(HCStringRef self) {
+    // Build the index privately, so that other threads only ever observe a complete index
+    HCInteger checkpointCapacity = self->codeUnitCount / HCStringCodePointCheckpointIntervalStatic + 1;
+    HCInteger* checkpoints = malloc(checkpointCapacity * sizeof(HCInteger));
+    HCInteger codePointCount = 0;
+    if (HCStringCodeUnitsAreValid(self->codeUnits, self->codeUnitCount)) {
+        // Index valid code units by their lead code units, which each begin a code point
+        codePointCount = HCStringIndexCodePoints(self->codeUnits, self->codeUnitCount, checkpoints);
+    }
+    else {
+        // Otherwise convert the code units one checkpoint interval at a time, recording the code unit offset at the start of each interval
+        HCStringCodeUnit* source = self->codeUnits;
+        HCStringCodePoint interval[HCStringCodePointCheckpointIntervalStatic];
+        for (HCInteger checkpointIndex = 0; source < self->codeUnits + self->codeUnitCount; checkpointIndex++) {
+            checkpoints[checkpointIndex] = source - self->codeUnits;
+            HCStringCodePoint* target = interval;
+            HCStringConvertCodeUnits(self, &source, NULL, &target, interval + HCStringCodePointCheckpointIntervalStatic);
+            HCInteger convertedCount = target - interval;
+            codePointCount += convertedCount;
+            if (convertedCount < HCStringCodePointCheckpointIntervalStatic) {
+                break;
+            }
+        }
+    }
+    
+    // Publish the index unless another thread published one first, in which case discard this identical copy
+    // NOTE: A published index is never freed before the string is destroyed, since readers on other threads may be using it
+    HCInteger* expected = NULL;
+    if (!atomic_compare_exchange_strong_explicit(&self->codePointCheckpoints, &expected, checkpoints, memory_order_release, memory_order_acquire)) {
+        free(checkpoints);
+    }
+    atomic_store_explicit(&self->codePointCount, codePointCount, memory_order_release);
+    return codePointCount;
+}
+
 void HCStringConvertCodeUnits(HCStringRef self, HCStringCodeUnit** sourceStart, HCStringCodeUnit* sourceEnd, HCStringCodePoint** targetStart, HCStringCodePoint* targetEnd) {
     HCStringCodeUnit* source = sourceStart == NULL ? self->codeUnits : *sourceStart;
     if (sourceEnd == NULL) {
@@ -259,6 +395,20 @@ void HCStringConvertCodeUnits(HCStringRef self, HCStringCodeUnit** sourceStart,
     HCStringCodePoint* target = targetStart == NULL ? NULL : *targetStart;
     
     while (source < sourceEnd) {
+        // Stop before writing past the end of the target, leaving the source at the next code point to convert
+        if (target >= targetEnd) {
+            break;
+        }
+        
+        // Convert runs of ASCII code units in bulk
+        if (writeTarget && *source < 0x80) {
+            HCInteger count = sourceEnd - source < targetEnd - target ? sourceEnd - source : targetEnd - target;
+            HCInteger convertedCount = HCStringConvertASCIICodeUnits(source, count, target);
+            source += convertedCount;
+            target += convertedCount;
+            continue;
+        }
+        
         HCStringCodePoint codePoint = 0;
         unsigned short extraBytesToRead = HCStringCodePointCodeUnitCount[*source]-1;
         if (source + extraBytesToRead >= sourceEnd) {
@@ -285,10 +435,6 @@ void HCStringConvertCodeUnits(HCStringRef self, HCStringCodeUnit** sourceStart,
             case 0: codePoint += *source++;
         }
         codePoint -= HCStringCodePointOffsets[extraBytesToRead];
-        if (target >= targetEnd) {
-            source -= (extraBytesToRead+1);
-            break;
-        }
         if (writeTarget) {
             if (codePoint <= HCStringCodePointMax) {
                 if (codePoint >= HCStringSurrogateHighStart && codePoint <= HCStringSurrogateLowEnd) {
@@ -393,10 +539,9 @@ HCReal HCStringAsReal(HCStringRef self) {
 // MARK: - Comparison
 //----------------------------------------------------------------------------------------------------------------------------------
 HCBoolean HCStringIsEqualToCString(HCStringRef self, const char* string) {
-    HCStringRef other = HCStringCreateWithCString(string);
-    HCBoolean result = HCStringIsEqual(self, other);
-    HCRelease(other);
-    return result;
+    HCString other = {0};
+    HCStringInitBorrowingCString(&other, string);
+    return HCStringIsEqual(self, &other);
 }
 
 HCBoolean HCStringContainsSameCodeUnits(HCStringRef self, HCStringRef other) {
@@ -82,6 +82,23 @@ HCStringRef HCStringCreateWithInteger(HCInteger value);
 ///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
 HCStringRef HCStringCreateWithReal(HCReal value);
 
+/// Obtains the interned string containing the same code units as a string.
+///
+/// Interned strings are kept in a global table, so interning equal strings returns references to the same string object. Comparing two interned strings using @c HCStringIsEqual() only compares their references.
+/// Interned strings remain in the table, and so are never destroyed.
+///
+/// @param string The string whose code units the interned string should contain.
+/// @returns A reference to the interned string.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count.
+HCStringRef HCStringCreateInterned(HCStringRef string);
+
+/// Obtains the interned string containing a UTF-8 encoded, null-terminated text buffer.
+/// @see @c HCStringCreateInterned()
+/// @param value A null-terminated buffer containing text data encoded using UTF-8.
+/// @returns A reference to the interned string.
+///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count.
+HCStringRef HCStringCreateInternedWithCString(const char* value);
+
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Object Polymorphic Functions
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -89,7 +106,7 @@ HCStringRef HCStringCreateWithReal(HCReal value);
 /// Determines if a string is equal to another string.
 /// @param self A reference to the string.
 /// @param other The other string to evaluate equality against.
-/// @returns @c true if @c self and @c other contain exactly the same UTF-8 code units.
+/// @returns @c true if @c self and @c other contain exactly the same UTF-8 code units. When both strings are interned, only their references are compared.
 /// @todo Should return @c true if the contained Unicode strings in @c self and @c other are equal according to the Unicode 13.0 standard for Canonical Equivalence. Do not rely on the results of this function for canonically equivalent string comparison, as its results will change in a future version. For a stable exact equivalence relation, see @c HCStringContainsSameCodeUnits().
 HCBoolean HCStringIsEqual(HCStringRef self, HCStringRef other);
 
@@ -113,6 +130,11 @@ void HCStringPrint(HCStringRef self, FILE* stream);
 /// @returns @c true if @c HCStringCodeUnitCount() is @c 0, or @c false otherwise.
 HCBoolean HCStringIsEmpty(HCStringRef self);
 
+/// Determines if a string has been interned.
+/// @param self A reference to the string.
+/// @returns @c true if @c self was returned from @c HCStringCreateInterned() or @c HCStringCreateInternedWithCString().
+HCBoolean HCStringIsInterned(HCStringRef self);
+
 /// Obtains the number of UTF-8 code units in a string.
 /// @param self A reference to the string.
 /// @returns The number of UTF-8 code units that make up the string value contained in the string.
@@ -13,26 +13,56 @@
 #include "../Core/HCObject_Internal.h"
 #include "HCString.h"
 
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Definitions
+//----------------------------------------------------------------------------------------------------------------------------------
+#define HCStringCodePointCheckpointIntervalStatic (64)
+
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Object Type
 //----------------------------------------------------------------------------------------------------------------------------------
-struct HCString {
+// NOTE: Copied code units are stored inline, following the string object in the same allocation, and are pointed to by codeUnits.
+//       Strings containing non-ASCII code units lazily build a sparse index holding the code unit offset of every checkpoint interval of code points.
+//       The index is published atomically, since strings may be shared across threads, and is never replaced once published.
+typedef struct HCString {
     HCObject base;
     HCInteger codeUnitCount;
     HCStringCodeUnit* codeUnits;
+    HCAtomicInteger hashValue;
+    HCBoolean isInterned;
+    HCBoolean isASCII;
+    HCAtomicInteger codePointCount;
+    HCInteger* _Atomic codePointCheckpoints;
+    HCStringCodeUnit inlineCodeUnits[];
 } HCString;
 
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Construction
 //----------------------------------------------------------------------------------------------------------------------------------
+HCStringRef HCStringAllocate(HCInteger codeUnitCount);
 void HCStringInit(void* memory, HCInteger codeUnitCount, HCStringCodeUnit* codeUnits);
 void HCStringInitWithoutCopying(void* memory, HCInteger codeUnitCount, HCStringCodeUnit* codeUnits);
+void HCStringInitBorrowingCString(void* memory, const char* value);
 void HCStringDestroy(HCStringRef self);
 
 //----------------------------------------------------------------------------------------------------------------------------------
 // MARK: - Conversion
 //----------------------------------------------------------------------------------------------------------------------------------
 HCBoolean HCStringCodeUnitSequeceIsValid(const HCStringCodeUnit* source, HCInteger count);
+HCInteger HCStringBuildCodePointIndex(HCStringRef self);
 void HCStringConvertCodeUnits(HCStringRef self, HCStringCodeUnit** sourceStart, HCStringCodeUnit* sourceEnd, HCStringCodePoint** targetStart, HCStringCodePoint* targetEnd);
 
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - UTF-8 Kernels
+//----------------------------------------------------------------------------------------------------------------------------------
+// NOTE: Each kernel dispatches at runtime to a vector implementation where available, and otherwise to its scalar implementation
+HCBoolean HCStringCodeUnitsAreASCII(const HCStringCodeUnit* codeUnits, HCInteger count);
+HCBoolean HCStringCodeUnitsAreASCIIScalar(const HCStringCodeUnit* codeUnits, HCInteger count);
+HCBoolean HCStringCodeUnitsAreValid(const HCStringCodeUnit* codeUnits, HCInteger count);
+HCBoolean HCStringCodeUnitsAreValidScalar(const HCStringCodeUnit* codeUnits, HCInteger count);
+HCInteger HCStringIndexCodePoints(const HCStringCodeUnit* codeUnits, HCInteger count, HCInteger* checkpoints);
+HCInteger HCStringIndexCodePointsScalar(const HCStringCodeUnit* codeUnits, HCInteger count, HCInteger* checkpoints);
+HCInteger HCStringConvertASCIICodeUnits(const HCStringCodeUnit* source, HCInteger count, HCStringCodePoint* target);
+HCInteger HCStringConvertASCIICodeUnitsScalar(const HCStringCodeUnit* source, HCInteger count, HCStringCodePoint* target);
+
 #endif /* HCString_Internal_h */
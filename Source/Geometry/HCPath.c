@@ -18,6 +18,8 @@ const HCObjectTypeData HCPathTypeDataInstance = {
     .base = {
         .ancestor = &HCObjectTypeDataInstance.base,
         .name = "HCPath",
+        .identifier = HCTypeIdentifierPath,
+        .kindMask = HCTypeKindMaskForIdentifier(HCTypeIdentifierObject) | HCTypeKindMaskForIdentifier(HCTypeIdentifierPath),
     },
     .isEqual = (void*)HCPathIsEqual,
     .hashValue = (void*)HCPathHashValue,
@@ -34,7 +36,7 @@ HCType HCPathType = (HCType)&HCPathTypeDataInstance;
 // MARK: - Construction
 //----------------------------------------------------------------------------------------------------------------------------------
 HCPathRef HCPathCreate() {
-    HCPathRef self = calloc(sizeof(HCPath), 1);
+    HCPathRef self = HCObjectAllocate(sizeof(HCPath));
     HCPathInit(self);
     return self;
 }
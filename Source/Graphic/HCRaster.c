@@ -18,6 +18,8 @@ const HCObjectTypeData HCRasterTypeDataInstance = {
     .base = {
         .ancestor = &HCObjectTypeDataInstance.base,
         .name = "HCRaster",
+        .identifier = HCTypeIdentifierRaster,
+        .kindMask = HCTypeKindMaskForIdentifier(HCTypeIdentifierObject) | HCTypeKindMaskForIdentifier(HCTypeIdentifierRaster),
     },
     .isEqual = (void*)HCRasterIsEqual,
     .hashValue = (void*)HCRasterHashValue,
@@ -39,7 +41,7 @@ HCRasterRef HCRasterCreate(HCInteger width, HCInteger height) {
         return NULL;
     }
     
-    HCRasterRef self = calloc(sizeof(HCRaster), 1);
+    HCRasterRef self = HCObjectAllocate(sizeof(HCRaster));
     HCRasterInit(self, width, height);
     return self;
 }
@@ -13,14 +13,20 @@
 
 #include "Core/HCCore.h"
 #include "Core/HCObject.h"
+#include "Core/HCObject+ReleaseQueue.h"
+#include "Core/HCArena.h"
+#include "Core/HCWeakRef.h"
 
 #include "Data/HCNumber.h"
 #include "Data/HCString.h"
 #include "Data/HCData.h"
+#include "Data/HCData+Coding.h"
 
 #include "Container/HCList.h"
 #include "Container/HCSet.h"
 #include "Container/HCMap.h"
+#include "Container/HCPersistentList.h"
+#include "Container/HCPersistentMap.h"
 
 #include "JSON/HCJSON.h"
 
@@ -8,6 +8,7 @@
 ///
 
 #include "HCJSON_Internal.h"
+#include "../Core/HCArena_Internal.h"
 #include <string.h>
 
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -20,6 +21,16 @@ HCRef HCJSONValueCreateWithData(HCDataRef data) {
     return value;
 }
 
+HCJSONValueRef HCJSONValueCreateWithDataInArena(HCDataRef data, HCArenaRef arena) {
+    // Parse the JSON text, then create the objects of the JSON value in the arena
+    json_value* jsonParserValue = json_parse((const json_char*)HCDataBytes(data), HCDataSize(data));
+    HCArenaRef previous = HCArenaBeginCreatingObjects(arena);
+    HCJSONValueRef value = HCJSONValueCreateWithJSONParserValue(jsonParserValue);
+    HCArenaEndCreatingObjects(previous);
+    json_value_free(jsonParserValue);
+    return value;
+}
+
 HCJSONValueRef HCJSONValueCreateWithJSONParserValue(json_value* jsonParserValue) {
     // Null values are HCJSONValueTypeNull
     if (jsonParserValue == NULL) {
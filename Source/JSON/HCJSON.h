@@ -10,6 +10,7 @@
 #ifndef HCJSON_h
 #define HCJSON_h
 
+#include "../Core/HCArena.h"
 #include "../Data/HCData.h"
 #include "../Data/HCNumber.h"
 #include "../Data/HCString.h"
@@ -50,6 +51,16 @@ typedef enum HCJSONValueType {
 ///     When finished with the reference, call @c HCRelease() on the reference to decrement the referenced object's reference count and destroy it when all references to are released.
 HCJSONValueRef HCJSONValueCreateWithData(HCDataRef data);
 
+/// Parses a JSON text to create an @c HCJSONValue whose objects are all created in an arena.
+///
+/// This avoids individually allocating, retaining, and releasing each object of a large JSON document that is used only until the arena is released.
+///
+/// @param data A data object containing a JSON text in UTF-8 format. See http://www.json.org.
+/// @param arena The arena in which the objects of the JSON value should be created.
+/// @returns An object that is one of the JSON value types. Use @c HCJSONValueTypeForObject() or @c HCObjectTypeOf() to determine the specific type of the returned object.
+///     The reference is valid until @c arena is destroyed, and calling @c HCRetain() or @c HCRelease() on it has no effect.
+HCJSONValueRef HCJSONValueCreateWithDataInArena(HCDataRef data, HCArenaRef arena);
+
 /// Produces a JSON text representing an @c HCJSONValue.
 /// @param value A reference to the JSON value to convert.
 /// @returns A data object containing a representation of @c value as a UTF-8 encoded JSON text. See http://www.json.org.
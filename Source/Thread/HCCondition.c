@@ -19,6 +19,8 @@ const HCObjectTypeData HCConditionTypeDataInstance = {
     .base = {
         .ancestor = &HCObjectTypeDataInstance.base,
         .name = "HCCondition",
+        .identifier = HCTypeIdentifierCondition,
+        .kindMask = HCTypeKindMaskForIdentifier(HCTypeIdentifierObject) | HCTypeKindMaskForIdentifier(HCTypeIdentifierCondition),
     },
     .isEqual = (void*)HCConditionIsEqual,
     .hashValue = (void*)HCConditionHashValue,
@@ -31,7 +33,7 @@ HCType HCConditionType = (HCType)&HCConditionTypeDataInstance;
 // MARK: - Construction
 //----------------------------------------------------------------------------------------------------------------------------------
 HCConditionRef HCConditionCreate(void) {
-    HCConditionRef self = calloc(sizeof(HCCondition), 1);
+    HCConditionRef self = HCObjectAllocate(sizeof(HCCondition));
     HCConditionInit(self);
     return self;
 }
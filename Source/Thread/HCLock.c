@@ -17,6 +17,8 @@ const HCObjectTypeData HCLockTypeDataInstance = {
     .base = {
         .ancestor = &HCObjectTypeDataInstance.base,
         .name = "HCLock",
+        .identifier = HCTypeIdentifierLock,
+        .kindMask = HCTypeKindMaskForIdentifier(HCTypeIdentifierObject) | HCTypeKindMaskForIdentifier(HCTypeIdentifierLock),
     },
     .isEqual = (void*)HCLockIsEqual,
     .hashValue = (void*)HCLockHashValue,
@@ -29,7 +31,7 @@ HCType HCLockType = (HCType)&HCLockTypeDataInstance;
 // MARK: - Construction
 //----------------------------------------------------------------------------------------------------------------------------------
 HCLockRef HCLockCreate(void) {
-    HCLockRef self = calloc(sizeof(HCLock), 1);
+    HCLockRef self = HCObjectAllocate(sizeof(HCLock));
     HCLockInit(self);
     return self;
 }
@@ -16,6 +16,8 @@ const HCObjectTypeData HCThreadTypeDataInstance = {
     .base = {
         .ancestor = &HCObjectTypeDataInstance.base,
         .name = "HCThread",
+        .identifier = HCTypeIdentifierThread,
+        .kindMask = HCTypeKindMaskForIdentifier(HCTypeIdentifierObject) | HCTypeKindMaskForIdentifier(HCTypeIdentifierThread),
     },
     .isEqual = (void*)HCThreadIsEqual,
     .hashValue = (void*)HCThreadHashValue,
@@ -35,7 +37,7 @@ HCThreadRef HCThreadCreateWithOptions(HCThreadFunction function, void* context,
     if (function == NULL) {
         return NULL;
     }
-    HCThreadRef self = calloc(sizeof(HCThread), 1);
+    HCThreadRef self = HCObjectAllocate(sizeof(HCThread));
     HCThreadInit(self, function, context, options);
     return self;
 }
@@ -0,0 +1,142 @@
+///
+/// @file HCThreadPool.c
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#include "HCThreadPool_Internal.h"
+#include "HCThread.h"
+#include "HCCondition.h"
+#include "../Core/HCArena_Internal.h"
+#include <pthread.h>
+#include <unistd.h>
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Definitions
+//----------------------------------------------------------------------------------------------------------------------------------
+
+/// Condition protecting the job queue, signaled when jobs are submitted or completed.
+static HCConditionRef HCThreadPoolCondition = NULL;
+/// Jobs with tasks that have not yet been claimed, in submission order. Protected by the lock of @c HCThreadPoolCondition.
+static HCThreadPoolJob* HCThreadPoolJobs = NULL;
+/// Number of worker threads in the pool.
+static HCInteger HCThreadPoolWorkerCount = 0;
+/// The @c pthread_once_t used ensure that the worker threads are only created once.
+static pthread_once_t HCThreadPoolSetupOnce = PTHREAD_ONCE_INIT;
+
+/// Claims and executes tasks of a job until all of its tasks have been claimed.
+/// @param job The job whose tasks should be executed.
+static void HCThreadPoolExecuteTasks(HCThreadPoolJob* job) {
+    for (HCInteger taskIndex = atomic_fetch_add(&job->nextTaskIndex, 1); taskIndex < job->taskCount; taskIndex = atomic_fetch_add(&job->nextTaskIndex, 1)) {
+        job->function(job->context, taskIndex);
+        if (atomic_fetch_add(&job->completedTaskCount, 1) + 1 == job->taskCount) {
+            // Wake the submitting thread when the last task completes
+            HCConditionRaiseEventAcquired(HCThreadPoolCondition, HCConditionEventBroadcast);
+        }
+    }
+}
+
+/// Removes a job from the job queue if it is still queued. Must be called with the lock of @c HCThreadPoolCondition acquired.
+/// @param job The job to remove.
+static void HCThreadPoolRemoveJob(HCThreadPoolJob* job) {
+    for (HCThreadPoolJob** link = &HCThreadPoolJobs; *link != NULL; link = &(*link)->next) {
+        if (*link == job) {
+            *link = job->next;
+            return;
+        }
+    }
+}
+
+/// Entry point of the worker threads, which execute tasks of queued jobs for the lifetime of the process.
+/// @param context Unused.
+static void HCThreadPoolWork(void* context) {
+    (void)context; // Unused
+    HCConditionAquire(HCThreadPoolCondition);
+    while (true) {
+        // Wait for a job with unclaimed tasks
+        HCThreadPoolJob* job = HCThreadPoolJobs;
+        if (job == NULL) {
+            HCConditionWait(HCThreadPoolCondition);
+            continue;
+        }
+        
+        // Execute tasks of the job without holding the lock, keeping the job alive by registering as one of its workers
+        job->workerCount++;
+        HCConditionRelinquish(HCThreadPoolCondition);
+        HCThreadPoolExecuteTasks(job);
+        HCConditionAquire(HCThreadPoolCondition);
+        HCThreadPoolRemoveJob(job);
+        job->workerCount--;
+        if (job->workerCount == 0) {
+            HCConditionBroadcast(HCThreadPoolCondition);
+        }
+    }
+}
+
+/// Creates the worker threads of the pool.
+static void HCThreadPoolSetup(void) {
+    // Create the pool objects outside of any arena, and share them between threads
+    HCArenaRef previousArena = HCArenaBeginCreatingObjects(NULL);
+    HCThreadPoolCondition = HCConditionCreate();
+    HCObjectMarkShared(HCThreadPoolCondition);
+    long processorCount = sysconf(_SC_NPROCESSORS_ONLN);
+    HCThreadPoolWorkerCount = processorCount > 1 ? (HCInteger)processorCount - 1 : 0;
+    for (HCInteger workerIndex = 0; workerIndex < HCThreadPoolWorkerCount; workerIndex++) {
+        // NOTE: Worker threads are never joined, so the references to them are intentionally kept
+        HCThreadRef worker = HCThreadCreate(HCThreadPoolWork, NULL);
+        HCObjectMarkShared(worker);
+        HCThreadExecute(worker);
+    }
+    HCArenaEndCreatingObjects(previousArena);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Execution
+//----------------------------------------------------------------------------------------------------------------------------------
+HCInteger HCThreadPoolThreadCount(void) {
+    pthread_once(&HCThreadPoolSetupOnce, HCThreadPoolSetup);
+    return HCThreadPoolWorkerCount + 1;
+}
+
+void HCThreadPoolExecute(HCInteger taskCount, HCThreadPoolTaskFunction function, void* context) {
+    // Execute tasks directly when there is nothing to share
+    if (taskCount <= 0) {
+        return;
+    }
+    if (taskCount == 1 || HCThreadPoolThreadCount() == 1) {
+        for (HCInteger taskIndex = 0; taskIndex < taskCount; taskIndex++) {
+            function(context, taskIndex);
+        }
+        return;
+    }
+    
+    // Queue the job and wake the workers
+    HCThreadPoolJob job = {
+        .function = function,
+        .context = context,
+        .taskCount = taskCount,
+        .nextTaskIndex = 0,
+        .completedTaskCount = 0,
+        .workerCount = 0,
+        .next = NULL,
+    };
+    HCConditionAquire(HCThreadPoolCondition);
+    HCThreadPoolJob** link = &HCThreadPoolJobs;
+    while (*link != NULL) {
+        link = &(*link)->next;
+    }
+    *link = &job;
+    HCConditionRelinquishRaisingEvent(HCThreadPoolCondition, HCConditionEventBroadcast);
+    
+    // Execute tasks alongside the workers, then wait for the tasks claimed by workers to complete and for workers to let go of the job
+    HCThreadPoolExecuteTasks(&job);
+    HCConditionAquire(HCThreadPoolCondition);
+    HCThreadPoolRemoveJob(&job);
+    while (atomic_load(&job.completedTaskCount) < taskCount || job.workerCount > 0) {
+        HCConditionWait(HCThreadPoolCondition);
+    }
+    HCConditionRelinquish(HCThreadPoolCondition);
+}
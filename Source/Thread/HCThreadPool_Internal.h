@@ -0,0 +1,38 @@
+///
+/// @file HCThreadPool_Internal.h
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#ifndef HCThreadPool_Internal_h
+#define HCThreadPool_Internal_h
+
+#include "../Core/HCObject_Internal.h"
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Definitions
+//----------------------------------------------------------------------------------------------------------------------------------
+typedef void (*HCThreadPoolTaskFunction)(void* context, HCInteger taskIndex);
+
+// NOTE: Workers are HCThreads created on first use, one fewer than the number of online processors, and kept for the lifetime of
+//       the process. The thread submitting tasks also executes them, so submitting from within a task cannot deadlock.
+typedef struct HCThreadPoolJob {
+    HCThreadPoolTaskFunction function;
+    void* context;
+    HCInteger taskCount;
+    HCAtomicInteger nextTaskIndex;
+    HCAtomicInteger completedTaskCount;
+    HCInteger workerCount;
+    struct HCThreadPoolJob* next;
+} HCThreadPoolJob;
+
+//----------------------------------------------------------------------------------------------------------------------------------
+// MARK: - Execution
+//----------------------------------------------------------------------------------------------------------------------------------
+HCInteger HCThreadPoolThreadCount(void);
+void HCThreadPoolExecute(HCInteger taskCount, HCThreadPoolTaskFunction function, void* context);
+
+#endif /* HCThreadPool_Internal_h */
@@ -0,0 +1,81 @@
+///
+/// @file HCAllocator_Internal.c
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#include "ctest.h"
+#include "../Source/HollowCore.h"
+#include "../Source/Core/HCAllocator_Internal.h"
+#include "../Source/Core/HCObject_Internal.h"
+#include <string.h>
+
+CTEST(HCAllocator_Internal, SizeClasses) {
+    ASSERT_EQUAL(HCAllocatorSizeClassForSize(0), HCAllocatorSizeClassNoneStatic);
+    ASSERT_EQUAL(HCAllocatorSizeClassForSize(HCAllocatorSizeClassCountStatic * HCAllocatorSizeClassGranularityStatic + 1), HCAllocatorSizeClassNoneStatic);
+    if (HCAllocatorEnabledStatic) {
+        ASSERT_EQUAL(HCAllocatorSizeClassForSize(1), 1);
+        ASSERT_EQUAL(HCAllocatorSizeClassForSize(16), 1);
+        ASSERT_EQUAL(HCAllocatorSizeClassForSize(17), 2);
+        ASSERT_EQUAL(HCAllocatorSizeForSizeClass(HCAllocatorSizeClassForSize(40)), 48);
+    }
+}
+
+CTEST(HCAllocator_Internal, Reuse) {
+    // Released objects are reused by the next allocation of their size class, and allocations are zeroed
+    HCNumberRef a = HCNumberCreateWithReal(1.0);
+    HCListRef list = HCListCreate();
+    ASSERT_EQUAL(((HCObjectRef)a)->sizeClass, HCAllocatorSizeClassForSize(sizeof(HCObject) + 16));
+    HCRelease(a);
+    HCNumberRef b = HCNumberCreateWithReal(2.0);
+    if (HCAllocatorEnabledStatic) {
+        ASSERT_TRUE(a == b);
+    }
+    ASSERT_DBL_NEAR(HCNumberAsReal(b), 2.0);
+    HCRelease(b);
+    HCMapRef map = HCMapCreate();
+    ASSERT_EQUAL(HCMapCount(map), 0);
+    HCRelease(map);
+    HCRelease(list);
+    
+    // Large objects are allocated by the C library
+    HCByte bytes[1000];
+    memset(bytes, 'a', sizeof(bytes));
+    HCStringRef string = HCStringCreateWithBytes(HCStringEncodingUTF8, sizeof(bytes), bytes);
+    ASSERT_EQUAL(((HCObjectRef)string)->sizeClass, HCAllocatorSizeClassNoneStatic);
+    HCRelease(string);
+}
+
+void HCAllocatorInternalTestThread(void* context) {
+    // Allocate and release enough objects to exchange blocks with the shared free lists, releasing half on another thread
+    HCListRef list = context;
+    for (HCInteger index = 0; index < 10000; index++) {
+        HCNumberRef number = HCNumberCreateWithReal((HCReal)index);
+        if (index % 2 == 0) {
+            HCRelease(number);
+        }
+        else {
+            HCListAddObjectReleased(list, number);
+        }
+    }
+}
+
+CTEST(HCAllocator_Internal, Threads) {
+    HCListRef lists[4];
+    HCThreadRef threads[4];
+    for (HCInteger index = 0; index < 4; index++) {
+        lists[index] = HCListCreate();
+        threads[index] = HCThreadCreateWithOptions(HCAllocatorInternalTestThread, lists[index], HCThreadOptionJoinOnDestroy);
+        HCThreadExecute(threads[index]);
+    }
+    for (HCInteger index = 0; index < 4; index++) {
+        HCThreadJoin(threads[index]);
+        HCRelease(threads[index]);
+        ASSERT_EQUAL(HCListCount(lists[index]), 5000);
+        ASSERT_DBL_NEAR(HCNumberAsReal(HCListLastObject(lists[index])), 9999.0);
+        HCRelease(lists[index]);
+    }
+}
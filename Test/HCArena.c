@@ -0,0 +1,77 @@
+///
+/// @file HCArena.c
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#include "ctest.h"
+#include "../Source/HollowCore.h"
+#include <string.h>
+
+CTEST(HCArena, Creation) {
+    HCArenaRef arena = HCArenaCreate();
+    ASSERT_EQUAL(HCArenaObjectCount(arena), 0);
+    ASSERT_EQUAL(HCArenaSize(arena), 0);
+    HCRelease(arena);
+}
+
+CTEST(HCArena, EqualHash) {
+    HCArenaRef a = HCArenaCreate();
+    HCArenaRef b = HCArenaCreate();
+    ASSERT_TRUE(HCArenaIsEqual(a, a));
+    ASSERT_FALSE(HCArenaIsEqual(a, b));
+    ASSERT_EQUAL(HCArenaHashValue(a), HCArenaHashValue(a));
+    HCRelease(a);
+    HCRelease(b);
+}
+
+CTEST(HCArena, Print) {
+    HCArenaRef arena = HCArenaCreate();
+    HCArenaPrint(arena, stdout); // TODO: Not to stdout
+    HCPrint(arena, stdout); // TODO: Not to stdout
+    HCRelease(arena);
+}
+
+HCRef HCArenaTestCreateList(void* context) {
+    // Build a list of strings, including one large enough to be stored outside its string object, and a list referencing an object outside the arena
+    HCListRef list = HCListCreate();
+    for (HCInteger index = 0; index < 1000; index++) {
+        HCListAddObjectReleased(list, HCStringCreateWithCString("arena"));
+    }
+    char large[100000];
+    memset(large, 'x', sizeof(large) - 1);
+    large[sizeof(large) - 1] = '\0';
+    HCListAddObjectReleased(list, HCStringCreateWithCString(large));
+    HCListAddObject(list, context);
+    return list;
+}
+
+CTEST(HCArena, CreateObject) {
+    HCArenaRef arena = HCArenaCreate();
+    HCNumberRef outside = HCNumberCreateWithReal(0.5);
+    HCListRef list = HCArenaCreateObject(arena, HCArenaTestCreateList, outside);
+    ASSERT_EQUAL(HCListCount(list), 1002);
+    ASSERT_TRUE(HCStringIsEqualToCString(HCListFirstObject(list), "arena"));
+    ASSERT_EQUAL(HCStringCodeUnitCount(HCListObjectAtIndex(list, 1000)), 99999);
+    ASSERT_TRUE(HCListLastObject(list) == outside);
+    ASSERT_EQUAL(HCArenaObjectCount(arena), 1002);
+    ASSERT_TRUE(HCArenaSize(arena) >= 100000);
+    
+    // Retain and release have no effect on objects in the arena
+    HCRetain(list);
+    HCRelease(list);
+    HCRelease(list);
+    ASSERT_EQUAL(HCListCount(list), 1002);
+    
+    // Objects created after the function returns are not created in the arena
+    HCNumberRef number = HCNumberCreateWithReal(1.5);
+    ASSERT_EQUAL(HCArenaObjectCount(arena), 1002);
+    HCRelease(number);
+    
+    // Releasing the arena releases objects outside the arena referenced by objects in the arena
+    HCRelease(arena);
+    HCRelease(outside);
+}
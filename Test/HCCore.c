@@ -80,3 +80,19 @@ CTEST(HCCore, RealEquality) {
 CTEST(HCData, RealPrint) {
     HCRealPrint(3.14159, stdout); // TODO: Not to stdout
 }
+
+CTEST(HCCore, BytesHash) {
+    HCByte bytes[256];
+    for (HCInteger index = 0; index < (HCInteger)sizeof(bytes); index++) {
+        bytes[index] = (HCByte)(index * 31);
+    }
+    ASSERT_EQUAL(HCBytesHashValue(0, NULL), HCBytesHashValue(0, bytes));
+    for (HCInteger size = 1; size <= (HCInteger)sizeof(bytes); size++) {
+        HCInteger hash = HCBytesHashValue(size, bytes);
+        ASSERT_EQUAL(hash, HCBytesHashValue(size, bytes));
+        ASSERT_NOT_EQUAL(hash, HCBytesHashValue(size - 1, bytes));
+        bytes[size - 1] ^= 1;
+        ASSERT_NOT_EQUAL(hash, HCBytesHashValue(size, bytes));
+        bytes[size - 1] ^= 1;
+    }
+}
@@ -287,3 +287,258 @@ CTEST(HCData, RemoveReal) {
     ASSERT_EQUAL(HCDataSize(data), 0);
     HCRelease(data);
 }
+
+CTEST(HCData, HashAfterChange) {
+    HCDataRef a = HCDataCreateWithInteger(0xBADF00D);
+    HCDataRef b = HCDataCreateWithInteger(0xBADF00D);
+    ASSERT_EQUAL(HCDataHashValue(a), HCDataHashValue(b));
+    HCInteger value = 0xF00D;
+    HCDataChangeBytes(a, 0, sizeof(value), (const HCByte*)&value);
+    ASSERT_FALSE(HCDataIsEqual(a, b));
+    HCDataChangeBytes(b, 0, sizeof(value), (const HCByte*)&value);
+    ASSERT_EQUAL(HCDataHashValue(a), HCDataHashValue(b));
+    HCDataAddInteger(a, value);
+    ASSERT_NOT_EQUAL(HCDataHashValue(a), HCDataHashValue(b));
+    HCDataRemoveInteger(a);
+    ASSERT_EQUAL(HCDataHashValue(a), HCDataHashValue(b));
+    HCRelease(a);
+    HCRelease(b);
+}
+
+CTEST(HCData, Capacity) {
+    HCDataRef data = HCDataCreateWithCapacity(100);
+    ASSERT_TRUE(HCDataIsEmpty(data));
+    ASSERT_EQUAL(HCDataCapacity(data), 100);
+    const HCByte* bytes = HCDataBytes(data);
+    for (HCInteger index = 0; index < 100; index++) {
+        HCDataAddBytes(data, 1, (const HCByte*)"x");
+    }
+    ASSERT_TRUE(HCDataBytes(data) == bytes);
+    HCDataAddBytes(data, 1, (const HCByte*)"y");
+    ASSERT_EQUAL(HCDataSize(data), 101);
+    ASSERT_EQUAL(HCDataCapacity(data), 200);
+    ASSERT_EQUAL(HCDataBytes(data)[99], 'x');
+    ASSERT_EQUAL(HCDataBytes(data)[100], 'y');
+    HCDataRemoveBytes(data, 51);
+    ASSERT_EQUAL(HCDataSize(data), 50);
+    ASSERT_EQUAL(HCDataCapacity(data), 200);
+    HCDataShrinkToFit(data);
+    ASSERT_EQUAL(HCDataCapacity(data), 50);
+    HCDataReserve(data, 10);
+    ASSERT_EQUAL(HCDataCapacity(data), 50);
+    HCDataReserve(data, 1000);
+    ASSERT_EQUAL(HCDataCapacity(data), 1000);
+    ASSERT_EQUAL(HCDataSize(data), 50);
+    ASSERT_EQUAL(HCDataBytes(data)[49], 'x');
+    HCDataClear(data);
+    HCDataShrinkToFit(data);
+    ASSERT_EQUAL(HCDataCapacity(data), 0);
+    HCDataAddInteger(data, 42);
+    ASSERT_EQUAL(HCDataAsInteger(data), 42);
+    HCRelease(data);
+}
+
+CTEST(HCData, Slice) {
+    HCDataRef data = HCDataCreateWithBytes(6, (const HCByte*)"abcdef");
+    HCDataRef slice = HCDataCreateSlice(data, 2, 3);
+    ASSERT_EQUAL(HCDataSize(slice), 3);
+    ASSERT_TRUE(HCDataBytes(slice) == HCDataBytes(data) + 2);
+    ASSERT_DATA(HCDataBytes(slice), 3, (const HCByte*)"cde", 3);
+    HCDataRef sliceOfSlice = HCDataCreateSlice(slice, 1, 100);
+    ASSERT_EQUAL(HCDataSize(sliceOfSlice), 2);
+    ASSERT_TRUE(HCDataBytes(sliceOfSlice) == HCDataBytes(data) + 3);
+    
+    // Modifying a data object copies the shared storage rather than changing the other data objects
+    HCDataChangeBytes(data, 3, 1, (const HCByte*)"X");
+    HCDataAddBytes(slice, 1, (const HCByte*)"Y");
+    ASSERT_DATA(HCDataBytes(data), 6, (const HCByte*)"abcXef", 6);
+    ASSERT_DATA(HCDataBytes(slice), 4, (const HCByte*)"cdeY", 4);
+    ASSERT_DATA(HCDataBytes(sliceOfSlice), 2, (const HCByte*)"de", 2);
+    HCRelease(data);
+    HCRelease(slice);
+    ASSERT_DATA(HCDataBytes(sliceOfSlice), 2, (const HCByte*)"de", 2);
+    HCRelease(sliceOfSlice);
+}
+
+CTEST(HCData, SliceKeepsSource) {
+    // Slicing leaves the storage of the sliced data object in place
+    HCDataRef data = HCDataCreateWithCapacity(64);
+    HCDataAddBytes(data, 6, (const HCByte*)"abcdef");
+    const HCByte* bytes = HCDataBytes(data);
+    HCDataRef slice = HCDataCreateSlice(data, 0, 6);
+    ASSERT_TRUE(HCDataBytes(data) == bytes);
+    ASSERT_EQUAL(HCDataCapacity(data), 64);
+    
+    // Modifying the sliced data object in place, even within its capacity, does not change the slice
+    HCDataRemoveBytes(data, 3);
+    HCDataAddBytes(data, 3, (const HCByte*)"XYZ");
+    ASSERT_DATA(HCDataBytes(data), 6, (const HCByte*)"abcXYZ", 6);
+    ASSERT_DATA(HCDataBytes(slice), 6, (const HCByte*)"abcdef", 6);
+    
+    // Slices of the modified data object point into its new storage, and slices of slices point into the storage they share
+    HCDataRef laterSlice = HCDataCreateSlice(data, 3, 3);
+    HCDataRef sliceOfSlice = HCDataCreateSlice(slice, 3, 3);
+    HCDataChangeBytes(data, 3, 1, (const HCByte*)"W");
+    ASSERT_DATA(HCDataBytes(data), 6, (const HCByte*)"abcWYZ", 6);
+    ASSERT_DATA(HCDataBytes(laterSlice), 3, (const HCByte*)"XYZ", 3);
+    ASSERT_DATA(HCDataBytes(sliceOfSlice), 3, (const HCByte*)"def", 3);
+    HCRelease(data);
+    HCRelease(slice);
+    ASSERT_DATA(HCDataBytes(laterSlice), 3, (const HCByte*)"XYZ", 3);
+    ASSERT_DATA(HCDataBytes(sliceOfSlice), 3, (const HCByte*)"def", 3);
+    HCRelease(laterSlice);
+    HCRelease(sliceOfSlice);
+}
+
+static void HCDataTestSlice(void* context) {
+    HCDataRef data = context;
+    for (HCInteger offset = 0; offset < HCDataSize(data); offset++) {
+        HCDataRef slice = HCDataCreateSlice(data, offset, 1);
+        ASSERT_EQUAL(HCDataBytes(slice)[0], (HCByte)offset);
+        HCDataRef sliceOfSlice = HCDataCreateSlice(slice, 0, 1);
+        HCRelease(slice);
+        ASSERT_EQUAL(HCDataBytes(sliceOfSlice)[0], (HCByte)offset);
+        HCRelease(sliceOfSlice);
+    }
+}
+
+CTEST(HCData, SliceThreads) {
+    // Slice the same data object on several threads at once while reading it
+    HCDataRef data = HCDataCreate();
+    for (HCInteger index = 0; index < 256; index++) {
+        HCDataAddBytes(data, 1, &(HCByte){(HCByte)index});
+    }
+    HCThreadRef threads[4];
+    for (HCInteger index = 0; index < 4; index++) {
+        threads[index] = HCThreadCreate(HCDataTestSlice, data);
+        HCThreadExecute(threads[index]);
+    }
+    HCDataTestSlice(data);
+    for (HCInteger index = 0; index < 4; index++) {
+        HCThreadJoin(threads[index]);
+        HCRelease(threads[index]);
+    }
+    ASSERT_EQUAL(HCDataSize(data), 256);
+    HCRelease(data);
+}
+
+CTEST(HCData, FileMapped) {
+    ASSERT_NULL(HCDataCreateWithContentsOfFileMapped("test_data_missing.bin"));
+    FILE* file = fopen("test_data_mapped.bin", "w");
+    fputs("{\"mapped\":[1,2,3]}", file);
+    fclose(file);
+    HCDataRef data = HCDataCreateWithContentsOfFileMapped("test_data_mapped.bin");
+    ASSERT_EQUAL(HCDataSize(data), 18);
+    ASSERT_DATA(HCDataBytes(data), 18, (const HCByte*)"{\"mapped\":[1,2,3]}", 18);
+    HCDataRef slice = HCDataCreateSlice(data, 11, 5);
+    ASSERT_DATA(HCDataBytes(slice), 5, (const HCByte*)"1,2,3", 5);
+    HCDataRemoveBytes(data, 1);
+    HCDataAddBytes(data, 1, (const HCByte*)"]");
+    ASSERT_DATA(HCDataBytes(data), 18, (const HCByte*)"{\"mapped\":[1,2,3]]", 18);
+    HCRelease(data);
+    ASSERT_DATA(HCDataBytes(slice), 5, (const HCByte*)"1,2,3", 5);
+    HCRelease(slice);
+    
+    file = fopen("test_data_empty.bin", "w");
+    fclose(file);
+    HCDataRef empty = HCDataCreateWithContentsOfFileMapped("test_data_empty.bin");
+    ASSERT_TRUE(HCDataIsEmpty(empty));
+    HCRelease(empty);
+    
+    // Files that are not regular files cannot be mapped
+    ASSERT_NULL(HCDataCreateWithContentsOfFileMapped("."));
+    
+#ifdef __linux__
+    // Virtual files reporting a size of zero are read instead of being mapped
+    HCDataRef status = HCDataCreateWithContentsOfFileMapped("/proc/self/status");
+    ASSERT_NOT_NULL(status);
+    ASSERT_TRUE(HCDataSize(status) > 0);
+    ASSERT_DATA(HCDataBytes(status), 5, (const HCByte*)"Name:", 5);
+    HCRelease(status);
+#endif
+}
+
+CTEST(HCData, Coding) {
+    HCDataRef data = HCDataCreate();
+    HCDataWriter writer = HCDataWriterBegin(data);
+    HCDataWriterReserve(&writer, 128);
+    ASSERT_TRUE(HCDataCapacity(data) >= 128);
+    HCDataWriterWriteUInt8(&writer, 0xAB);
+    HCDataWriterWriteUInt16(&writer, 0x1234);
+    HCDataWriterWriteUInt32(&writer, 0xDEADBEEF);
+    HCDataWriterWriteUInt64(&writer, 0x0123456789ABCDEF);
+    HCDataWriterWriteBoolean(&writer, true);
+    HCDataWriterWriteInteger(&writer, -42);
+    HCDataWriterWriteReal(&writer, 3.25);
+    HCDataWriterWriteVarUInteger(&writer, 300);
+    HCDataWriterWriteVarUInteger(&writer, UINT64_MAX);
+    HCDataWriterWriteVarInteger(&writer, -1);
+    HCDataWriterWriteVarInteger(&writer, INT64_MIN);
+    HCDataWriterWriteBlob(&writer, 3, (const HCByte*)"abc");
+    HCStringRef string = HCStringCreateWithCString("\xC3\xA9t\xC3\xA9");
+    HCDataWriterWriteString(&writer, string);
+    
+    // Check the encoding of fixed-width and variable-width values
+    ASSERT_EQUAL(HCDataBytes(data)[1], 0x34);
+    ASSERT_EQUAL(HCDataBytes(data)[2], 0x12);
+    ASSERT_EQUAL(HCDataBytes(data)[3], 0xEF);
+    ASSERT_DATA(HCDataBytes(data) + 32, 2, (const HCByte*)"\xAC\x02", 2);
+    ASSERT_EQUAL(HCDataBytes(data)[44], 0x01);
+    
+    HCDataReader reader = HCDataReaderBegin(data);
+    ASSERT_EQUAL(HCDataReaderReadUInt8(&reader), 0xAB);
+    ASSERT_EQUAL(HCDataReaderReadUInt16(&reader), 0x1234);
+    ASSERT_EQUAL(HCDataReaderReadUInt32(&reader), 0xDEADBEEF);
+    ASSERT_TRUE(HCDataReaderReadUInt64(&reader) == 0x0123456789ABCDEF);
+    ASSERT_TRUE(HCDataReaderReadBoolean(&reader));
+    ASSERT_EQUAL(HCDataReaderReadInteger(&reader), -42);
+    ASSERT_DBL_NEAR(HCDataReaderReadReal(&reader), 3.25);
+    ASSERT_EQUAL(HCDataReaderReadVarUInteger(&reader), 300);
+    ASSERT_TRUE(HCDataReaderReadVarUInteger(&reader) == UINT64_MAX);
+    ASSERT_EQUAL(HCDataReaderReadVarInteger(&reader), -1);
+    ASSERT_TRUE(HCDataReaderReadVarInteger(&reader) == INT64_MIN);
+    HCInteger size = 0;
+    const HCByte* blob = HCDataReaderReadBlob(&reader, &size);
+    ASSERT_EQUAL(size, 3);
+    ASSERT_TRUE(blob > HCDataBytes(data) && blob < HCDataBytes(data) + HCDataSize(data));
+    ASSERT_DATA(blob, 3, (const HCByte*)"abc", 3);
+    HCStringRef decodedString = HCDataReaderReadStringRetained(&reader);
+    ASSERT_TRUE(HCStringIsEqual(decodedString, string));
+    ASSERT_TRUE(HCDataReaderIsAtEnd(&reader));
+    ASSERT_FALSE(HCDataReaderHasFailed(&reader));
+    
+    // Reading past the end fails and stays failed
+    ASSERT_EQUAL(HCDataReaderReadUInt32(&reader), 0);
+    ASSERT_TRUE(HCDataReaderHasFailed(&reader));
+    HCRelease(decodedString);
+    HCRelease(string);
+    HCRelease(data);
+}
+
+CTEST(HCData, CodingMalformed) {
+    HCDataRef data = HCDataCreateWithBytes(11, (const HCByte*)"\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x02\x00");
+    HCDataReader reader = HCDataReaderBegin(data);
+    ASSERT_EQUAL(HCDataReaderReadVarUInteger(&reader), 0);
+    ASSERT_TRUE(HCDataReaderHasFailed(&reader));
+    HCRelease(data);
+    
+    data = HCDataCreate();
+    HCDataWriter writer = HCDataWriterBegin(data);
+    HCDataWriterWriteVarUInteger(&writer, 5);
+    HCDataWriterWriteBytes(&writer, 4, (const HCByte*)"abcd");
+    reader = HCDataReaderBegin(data);
+    HCInteger size = -1;
+    ASSERT_NULL(HCDataReaderReadBlob(&reader, &size));
+    ASSERT_EQUAL(size, 0);
+    ASSERT_TRUE(HCDataReaderIsAtEnd(&reader));
+    
+    // Blobs decoded as data share storage with the source
+    reader = HCDataReaderBegin(data);
+    HCDataRemoveBytes(data, 5);
+    HCDataWriterWriteBlob(&writer, 2, (const HCByte*)"xy");
+    HCDataRef blob = HCDataReaderReadBlobDataRetained(&reader);
+    ASSERT_TRUE(HCDataBytes(blob) == HCDataBytes(data) + 1);
+    ASSERT_DATA(HCDataBytes(blob), 2, (const HCByte*)"xy", 2);
+    HCRelease(blob);
+    HCRelease(data);
+}
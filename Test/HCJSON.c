@@ -162,3 +162,22 @@ CTEST(HCJSON, ObjectData) {
     HCRelease(value);
     HCRelease(jsonString);
 }
+
+CTEST(HCJSON, InArena) {
+    const char* json = "{\"name\":\"HollowCore\",\"values\":[1,2.5,true,\"text\",{\"nested\":[]}]}";
+    HCDataRef data = HCDataCreateWithBytes(strlen(json), (HCByte*)json);
+    HCArenaRef arena = HCArenaCreate();
+    HCRef value = HCJSONValueCreateWithDataInArena(data, arena);
+    HCRef heapValue = HCJSONValueCreateWithData(data);
+    ASSERT_TRUE(HCIsEqual(value, heapValue));
+    ASSERT_TRUE(HCArenaObjectCount(arena) > 0);
+    HCDataRef serialized = HCJSONValueAsDataRetained(value);
+    HCRef reparsed = HCJSONValueCreateWithData(serialized);
+    ASSERT_TRUE(HCIsEqual(reparsed, heapValue));
+    HCRelease(reparsed);
+    HCRelease(serialized);
+    HCRelease(heapValue);
+    HCRelease(value);
+    HCRelease(arena);
+    HCRelease(data);
+}
@@ -10,6 +10,7 @@
 #include "ctest.h"
 #include "../Source/HollowCore.h"
 #include <math.h>
+#include <stdatomic.h>
 
 CTEST(HCList, Creation) {
     HCListRef empty = HCListCreate();
@@ -264,6 +265,222 @@ CTEST(HCList, CompoundRemove) {
     HCRelease(four);
 }
 
+CTEST(HCList, BulkOperations) {
+    HCRef numbers[100];
+    for (HCInteger index = 0; index < 100; index++) {
+        numbers[index] = HCStringCreateWithInteger(index);
+    }
+    HCListRef list = HCListCreateWithCapacity(1);
+
+    // Add to empty, append, and insert in the middle
+    HCListAddObjects(list, 0, numbers + 10, 10);
+    HCListAddObjects(list, 10, numbers + 90, 10);
+    HCListAddObjects(list, 10, numbers + 20, 70);
+    HCListAddObjects(list, 0, numbers, 10);
+    ASSERT_EQUAL(HCListCount(list), 100);
+    for (HCInteger index = 0; index < 100; index++) {
+        ASSERT_TRUE(HCListObjectAtIndex(list, index) == numbers[index]);
+    }
+
+    // Invalid ranges leave the list unmodified
+    HCListAddObjects(list, 101, numbers, 1);
+    HCListAddObjects(list, -1, numbers, 1);
+    HCListRemoveObjectsInRange(list, 50, 51);
+    HCListRemoveObjectsInRange(list, -1, 2);
+    HCListReplaceObjectsInRange(list, 99, 2, numbers, 1);
+    ASSERT_EQUAL(HCListCount(list), 100);
+
+    // Remove ranges from the middle, end, and start
+    HCListRemoveObjectsInRange(list, 40, 20);
+    ASSERT_EQUAL(HCListCount(list), 80);
+    ASSERT_TRUE(HCListObjectAtIndex(list, 39) == numbers[39]);
+    ASSERT_TRUE(HCListObjectAtIndex(list, 40) == numbers[60]);
+    HCListRemoveObjectsInRange(list, 70, 10);
+    HCListRemoveObjectsInRange(list, 0, 10);
+    ASSERT_EQUAL(HCListCount(list), 60);
+    ASSERT_TRUE(HCListFirstObject(list) == numbers[10]);
+    ASSERT_TRUE(HCListLastObject(list) == numbers[89]);
+
+    // Replace ranges with fewer, equal, and more objects
+    HCListReplaceObjectsInRange(list, 0, 30, numbers, 5);
+    ASSERT_EQUAL(HCListCount(list), 35);
+    ASSERT_TRUE(HCListObjectAtIndex(list, 4) == numbers[4]);
+    ASSERT_TRUE(HCListObjectAtIndex(list, 5) == numbers[60]);
+    HCListReplaceObjectsInRange(list, 5, 5, numbers + 5, 5);
+    ASSERT_TRUE(HCListObjectAtIndex(list, 9) == numbers[9]);
+    ASSERT_TRUE(HCListObjectAtIndex(list, 10) == numbers[65]);
+    HCListReplaceObjectsInRange(list, 10, 25, numbers + 10, 90);
+    ASSERT_EQUAL(HCListCount(list), 100);
+    for (HCInteger index = 0; index < 100; index++) {
+        ASSERT_TRUE(HCListObjectAtIndex(list, index) == numbers[index]);
+    }
+
+    // Replace a range with the objects it already contains
+    HCListReplaceObjectsInRange(list, 0, 100, numbers, 100);
+    ASSERT_EQUAL(HCListCount(list), 100);
+    ASSERT_TRUE(HCListObjectAtIndex(list, 50) == numbers[50]);
+
+    // Remove many equal objects in one pass, preserving order of the rest
+    HCListClear(list);
+    for (HCInteger index = 0; index < 300; index++) {
+        HCListAddObject(list, numbers[index % 3]);
+    }
+    HCListRemoveAllObjectsEqualToObject(list, numbers[1]);
+    ASSERT_FALSE(HCListContainsObject(list, numbers[1]));
+    ASSERT_EQUAL(HCListCount(list), 200);
+    ASSERT_TRUE(HCListObjectAtIndex(list, 0) == numbers[0]);
+    ASSERT_TRUE(HCListObjectAtIndex(list, 1) == numbers[2]);
+    ASSERT_TRUE(HCListObjectAtIndex(list, 198) == numbers[0]);
+    ASSERT_TRUE(HCListObjectAtIndex(list, 199) == numbers[2]);
+    HCListRemoveObjectsInRange(list, 0, HCListCount(list));
+    ASSERT_TRUE(HCListIsEmpty(list));
+
+    HCRelease(list);
+    for (HCInteger index = 0; index < 100; index++) {
+        HCRelease(numbers[index]);
+    }
+}
+
+CTEST(HCList, Deque) {
+    // Use the list as a queue
+    HCListRef list = HCListCreateWithCapacity(4);
+    HCInteger next = 0;
+    for (HCInteger index = 0; index < 1000; index++) {
+        HCListAddObjectReleased(list, HCNumberCreateWithInteger(index));
+        if (index % 3 != 0) {
+            HCNumberRef number = HCListRemoveFirstObjectRetained(list);
+            ASSERT_EQUAL(HCNumberAsInteger(number), next++);
+            HCRelease(number);
+        }
+    }
+    ASSERT_EQUAL(HCListCount(list), 1000 - next);
+    for (HCListIterator i = HCListIterationBegin(list); !HCListIterationHasEnded(&i); HCListIterationNext(&i)) {
+        ASSERT_EQUAL(HCNumberAsInteger(i.object), next + i.index);
+    }
+
+    // Push and pop at both ends as a double-ended queue
+    HCListClear(list);
+    for (HCInteger index = 1; index <= 100; index++) {
+        HCListAddFirstObjectReleased(list, HCNumberCreateWithInteger(-index));
+        HCListAddObjectReleased(list, HCNumberCreateWithInteger(index));
+    }
+    ASSERT_EQUAL(HCListCount(list), 200);
+    ASSERT_EQUAL(HCNumberAsInteger(HCListFirstObject(list)), -100);
+    ASSERT_EQUAL(HCNumberAsInteger(HCListLastObject(list)), 100);
+    for (HCInteger index = 0; index < 100; index++) {
+        ASSERT_EQUAL(HCNumberAsInteger(HCListObjectAtIndex(list, index)), index - 100);
+        ASSERT_EQUAL(HCNumberAsInteger(HCListObjectAtIndex(list, index + 100)), index + 1);
+    }
+    for (HCInteger index = 100; index > 50; index--) {
+        ASSERT_EQUAL(HCNumberAsInteger(HCListFirstObject(list)), -index);
+        HCListRemoveFirstObject(list);
+        ASSERT_EQUAL(HCNumberAsInteger(HCListLastObject(list)), index);
+        HCListRemoveObject(list);
+    }
+    ASSERT_EQUAL(HCListCount(list), 100);
+
+    // Insert and remove near both ends
+    HCListAddObjectReleasedAtIndex(list, 1, HCNumberCreateWithInteger(1000));
+    HCListAddObjectReleasedAtIndex(list, HCListCount(list) - 1, HCNumberCreateWithInteger(2000));
+    ASSERT_EQUAL(HCNumberAsInteger(HCListObjectAtIndex(list, 0)), -50);
+    ASSERT_EQUAL(HCNumberAsInteger(HCListObjectAtIndex(list, 1)), 1000);
+    ASSERT_EQUAL(HCNumberAsInteger(HCListObjectAtIndex(list, 2)), -49);
+    ASSERT_EQUAL(HCNumberAsInteger(HCListObjectAtIndex(list, 100)), 2000);
+    ASSERT_EQUAL(HCNumberAsInteger(HCListObjectAtIndex(list, 101)), 50);
+    HCListRemoveObjectAtIndex(list, 1);
+    HCListRemoveObjectAtIndex(list, 99);
+    for (HCInteger index = 0; index < 100; index++) {
+        HCInteger value = index < 50 ? index - 50 : index - 49;
+        ASSERT_EQUAL(HCNumberAsInteger(HCListObjectAtIndex(list, index)), value);
+    }
+
+    // Drain from the front
+    while (!HCListIsEmpty(list)) {
+        HCListRemoveFirstObject(list);
+    }
+    HCListRemoveFirstObject(list);
+    ASSERT_NULL(HCListRemoveFirstObjectRetained(list));
+    HCRelease(list);
+}
+
+HCInteger HCListTestCompareKeys(void* context, HCRef object, HCRef otherObject) {
+    HCInteger divisor = *(HCInteger*)context;
+    return HCNumberAsInteger(object) / divisor - HCNumberAsInteger(otherObject) / divisor;
+}
+
+CTEST(HCList, Sort) {
+    HCInteger count = 5000;
+    HCInteger divisor = 1;
+    HCListRef list = HCListCreate();
+    HCListRef sorted = HCListCreate();
+    for (HCInteger pattern = 0; pattern < 5; pattern++) {
+        // Sort random, sorted, reversed, organ pipe, and constant sequences
+        HCListClear(list);
+        for (HCInteger index = 0; index < count; index++) {
+            HCInteger value =
+                pattern == 0 ? (index * 7919) % count :
+                pattern == 1 ? index :
+                pattern == 2 ? count - index :
+                pattern == 3 ? (index < count / 2 ? index : count - index) :
+                42;
+            HCListAddObjectReleased(list, HCNumberCreateWithInteger(value));
+        }
+        HCListSort(list, HCListTestCompareKeys, &divisor);
+        ASSERT_EQUAL(HCListCount(list), count);
+        for (HCInteger index = 1; index < count; index++) {
+            ASSERT_TRUE(HCNumberAsInteger(HCListObjectAtIndex(list, index - 1)) <= HCNumberAsInteger(HCListObjectAtIndex(list, index)));
+        }
+    }
+
+    // Stable sorts keep elements with equal keys in their original order
+    divisor = 10000;
+    for (HCInteger index = 0; index < count; index++) {
+        HCListAddObjectReleased(sorted, HCNumberCreateWithInteger(((index * 7919) % 50) * divisor + index));
+    }
+    for (HCInteger parallel = 0; parallel < 2; parallel++) {
+        HCListClear(list);
+        for (HCListIterator i = HCListIterationBegin(sorted); !HCListIterationHasEnded(&i); HCListIterationNext(&i)) {
+            HCListAddObject(list, i.object);
+        }
+        if (parallel) {
+            HCListSortParallel(list, HCListTestCompareKeys, &divisor);
+        }
+        else {
+            HCListSortStable(list, HCListTestCompareKeys, &divisor);
+        }
+        ASSERT_EQUAL(HCListCount(list), count);
+        for (HCInteger index = 1; index < count; index++) {
+            ASSERT_TRUE(HCNumberAsInteger(HCListObjectAtIndex(list, index - 1)) < HCNumberAsInteger(HCListObjectAtIndex(list, index)));
+        }
+    }
+
+    // Binary search finds the first equal element, and sorted insertion adds after equal elements
+    divisor = 1;
+    HCListClear(sorted);
+    for (HCInteger index = 0; index < 100; index++) {
+        HCNumberRef number = HCNumberCreateWithInteger((index * 37) % 50 * 2);
+        HCListAddObjectSorted(sorted, number, HCListTestCompareKeys, &divisor);
+        HCRelease(number);
+    }
+    ASSERT_EQUAL(HCListCount(sorted), 100);
+    for (HCInteger index = 1; index < 100; index++) {
+        ASSERT_TRUE(HCNumberAsInteger(HCListObjectAtIndex(sorted, index - 1)) <= HCNumberAsInteger(HCListObjectAtIndex(sorted, index)));
+    }
+    for (HCInteger value = -1; value <= 100; value++) {
+        HCNumberRef number = HCNumberCreateWithInteger(value);
+        HCInteger index = HCListBinarySearch(sorted, number, HCListTestCompareKeys, &divisor);
+        if (value % 2 == 0 && value >= 0 && value < 100) {
+            ASSERT_EQUAL(index, value);
+        }
+        else {
+            ASSERT_EQUAL(index, HCListNotFound);
+        }
+        HCRelease(number);
+    }
+    HCRelease(list);
+    HCRelease(sorted);
+}
+
 CTEST(HCList, MemoryConvenience) {
     HCNumberRef zero = HCNumberCreateWithInteger(0);
     HCNumberRef one = HCNumberCreateWithInteger(1);
@@ -665,3 +882,151 @@ CTEST(HCList, Reduce) {
     HCRelease(total);
     HCRelease(list);
 }
+
+void HCListForEachParallelTestFunction(void* context, HCListRef list, HCInteger index, HCRef object) {
+    (void)list; // Unused
+    if (HCNumberAsInteger(object) == index) {
+        atomic_fetch_add((_Atomic HCInteger*)context, index);
+    }
+}
+
+HCBoolean HCListFilterParallelTestFunction(void* context, HCListRef list, HCInteger index, HCRef object) {
+    (void)context; // Unused
+    (void)list; // Unused
+    (void)index; // Unused
+    return HCNumberAsInteger(object) % 3 == 0;
+}
+
+HCRef HCListMapParallelTestFunction(void* context, HCListRef list, HCInteger index, HCRef object) {
+    (void)context; // Unused
+    (void)list; // Unused
+    (void)index; // Unused
+    return HCStringCreateWithInteger(HCNumberAsInteger(object));
+}
+
+HCRef HCListReduceParallelTestFunction(void* context, HCRef aggregate, HCListRef list, HCInteger index, HCRef object) {
+    (void)context; // Unused
+    (void)list; // Unused
+    (void)index; // Unused
+    HCListRef next = HCListMapRetained(aggregate, NULL, NULL);
+    HCListAddObject(next, object);
+    return next;
+}
+
+HCRef HCListCombineParallelTestFunction(void* context, HCRef partialResult, HCRef otherPartialResult) {
+    (void)context; // Unused
+    HCListRef combined = HCListMapRetained(partialResult, NULL, NULL);
+    for (HCListIterator i = HCListIterationBegin(otherPartialResult); !HCListIterationHasEnded(&i); HCListIterationNext(&i)) {
+        HCListAddObject(combined, i.object);
+    }
+    return combined;
+}
+
+CTEST(HCList, ParallelChunkBoundaries) {
+    // Lists of every size up to beyond the chunk count visit each element once, in every chunk layout
+    HCListRef list = HCListCreate();
+    for (HCInteger count = 0; count <= 300; count++) {
+        _Atomic HCInteger sum = 0;
+        HCListForEachParallel(list, HCListForEachParallelTestFunction, &sum);
+        ASSERT_EQUAL(sum, count * (count - 1) / 2);
+        
+        HCListRef filtered = HCListFilterRetainedParallel(list, HCListFilterParallelTestFunction, NULL);
+        HCListRef serialFiltered = HCListFilterRetained(list, HCListFilterParallelTestFunction, NULL);
+        ASSERT_EQUAL(HCListCount(filtered), (count + 2) / 3);
+        ASSERT_TRUE(HCListIsEqual(filtered, serialFiltered));
+        HCRelease(filtered);
+        HCRelease(serialFiltered);
+        
+        HCListRef mapped = HCListMapRetainedParallel(list, HCListMapParallelTestFunction, NULL);
+        ASSERT_EQUAL(HCListCount(mapped), count);
+        for (HCInteger index = 0; index < count; index++) {
+            ASSERT_EQUAL(HCStringAsInteger(HCListObjectAtIndex(mapped, index)), index);
+        }
+        HCRelease(mapped);
+        HCListRef copied = HCListMapRetainedParallel(list, NULL, NULL);
+        ASSERT_TRUE(HCListIsEqual(copied, list));
+        HCRelease(copied);
+        
+        HCListAddObjectReleased(list, HCNumberCreateWithInteger(count));
+    }
+    HCRelease(list);
+}
+
+CTEST(HCList, ParallelReduceOddChunks) {
+    // Lists shorter than the chunk count reduce over one chunk per element, so every odd and even number of partial results is combined
+    HCListRef list = HCListCreate();
+    HCListRef empty = HCListCreate();
+    HCListRef emptyReduced = HCListReduceRetainedParallel(list, empty, HCListReduceParallelTestFunction, HCListCombineParallelTestFunction, NULL);
+    ASSERT_TRUE(emptyReduced == empty);
+    HCRelease(emptyReduced);
+    for (HCInteger count = 1; count <= 200; count++) {
+        HCListAddObjectReleased(list, HCNumberCreateWithInteger(count));
+        HCListRef reduced = HCListReduceRetainedParallel(list, empty, HCListReduceParallelTestFunction, HCListCombineParallelTestFunction, NULL);
+        ASSERT_TRUE(HCListIsEqual(reduced, list));
+        HCRelease(reduced);
+    }
+    
+    // Lists longer than the chunk count reduce over chunks of several elements
+    for (HCInteger count = 201; count <= 2001; count++) {
+        HCListAddObjectReleased(list, HCNumberCreateWithInteger(count));
+    }
+    HCListRef reduced = HCListReduceRetainedParallel(list, empty, HCListReduceParallelTestFunction, HCListCombineParallelTestFunction, NULL);
+    ASSERT_TRUE(HCListIsEqual(reduced, list));
+    HCRelease(reduced);
+    HCRelease(empty);
+    HCRelease(list);
+}
+
+CTEST(HCList, SortParallelStability) {
+    // Sort lists of sizes that do not divide evenly into chunks, with many elements sharing each key
+    HCInteger divisor = 100000;
+    HCInteger counts[] = { 1, 7, 1000, 4999, 20011, 65537 };
+    for (HCInteger countIndex = 0; countIndex < (HCInteger)(sizeof(counts) / sizeof(counts[0])); countIndex++) {
+        HCInteger count = counts[countIndex];
+        HCListRef list = HCListCreate();
+        for (HCInteger index = 0; index < count; index++) {
+            HCListAddObjectReleased(list, HCNumberCreateWithInteger(((index * 7919) % 37) * divisor + index));
+        }
+        HCListRef serialSorted = HCListMapRetained(list, NULL, NULL);
+        HCListSortStable(serialSorted, HCListTestCompareKeys, &divisor);
+        HCListSortParallel(list, HCListTestCompareKeys, &divisor);
+        
+        // Elements with equal keys keep their original order, which matches the serial stable sort
+        ASSERT_EQUAL(HCListCount(list), count);
+        for (HCInteger index = 1; index < count; index++) {
+            ASSERT_TRUE(HCNumberAsInteger(HCListObjectAtIndex(list, index - 1)) < HCNumberAsInteger(HCListObjectAtIndex(list, index)));
+        }
+        ASSERT_TRUE(HCListIsEqual(list, serialSorted));
+        HCRelease(serialSorted);
+        HCRelease(list);
+    }
+}
+
+static HCBoolean HCListFilterParallelTestIndexFunction(void* context, HCListRef list, HCInteger index, HCRef object) {
+    (void)context; // Unused
+    (void)list; // Unused
+    (void)object; // Unused
+    return index % 3 == 0;
+}
+
+static HCRef HCListTestCreateConfinedList(void* context) {
+    HCListRef list = HCListCreate();
+    for (HCInteger index = 0; index < *(HCInteger*)context; index++) {
+        HCListAddObjectReleased(list, HCStringCreateWithCString("confined to the calling thread"));
+    }
+    return list;
+}
+
+CTEST(HCList, ParallelThreadConfined) {
+    // Elements confined to the calling thread are only retained by the calling thread
+    HCInteger count = 1000;
+    HCListRef list = HCObjectCreateThreadConfined(HCListTestCreateConfinedList, &count);
+    ASSERT_TRUE(HCObjectIsThreadConfined(HCListFirstObject(list)));
+    HCListRef filtered = HCListFilterRetainedParallel(list, HCListFilterParallelTestIndexFunction, NULL);
+    ASSERT_EQUAL(HCListCount(filtered), 334);
+    HCRelease(filtered);
+    HCListRef copied = HCListMapRetainedParallel(list, NULL, NULL);
+    ASSERT_TRUE(HCListIsEqual(copied, list));
+    HCRelease(copied);
+    HCRelease(list);
+}
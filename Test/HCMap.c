@@ -471,3 +471,205 @@ CTEST(HCMap, IterationLoop) {
     
     HCRelease(map);
 }
+
+CTEST(HCMap, Growth) {
+    HCInteger count = 10000;
+    HCMapRef map = HCMapCreateWithCapacity(0);
+    for (HCInteger index = 0; index < count; index++) {
+        HCMapAddObjectReleasedForKeyReleased(map, HCStringCreateWithInteger(index), HCNumberCreateWithInteger(index));
+    }
+    ASSERT_EQUAL(HCMapCount(map), count);
+    for (HCInteger index = 0; index < count; index += 2) {
+        HCStringRef key = HCStringCreateWithInteger(index);
+        HCMapAddObjectReleasedForKey(map, key, HCNumberCreateWithInteger(-index));
+        HCRelease(key);
+    }
+    ASSERT_EQUAL(HCMapCount(map), count);
+    for (HCInteger index = 0; index < count; index++) {
+        HCStringRef key = HCStringCreateWithInteger(index);
+        ASSERT_EQUAL(HCNumberAsInteger(HCMapObjectForKey(map, key)), index % 2 == 0 ? -index : index);
+        HCRelease(key);
+    }
+    for (HCInteger index = 0; index < count; index += 2) {
+        HCStringRef key = HCStringCreateWithInteger(index);
+        HCMapRemoveObjectForKey(map, key);
+        ASSERT_FALSE(HCMapContainsKey(map, key));
+        HCRelease(key);
+    }
+    ASSERT_EQUAL(HCMapCount(map), count / 2);
+    HCInteger iterationCount = 0;
+    for (HCMapIterator i = HCMapIterationBegin(map); !HCMapIterationHasEnded(&i); HCMapIterationNext(&i)) {
+        ASSERT_EQUAL(HCNumberAsInteger(i.object), HCStringAsInteger(i.key));
+        iterationCount++;
+    }
+    ASSERT_EQUAL(iterationCount, count / 2);
+    HCRelease(map);
+}
+
+CTEST(HCMap, InsertionOrder) {
+    HCMapRef map = HCMapCreate();
+    for (HCInteger index = 100; index > 0; index--) {
+        HCMapAddObjectReleasedForKeyReleased(map, HCStringCreateWithInteger(index), HCNumberCreateWithInteger(index));
+    }
+    for (HCInteger index = 100; index > 0; index -= 3) {
+        HCStringRef key = HCStringCreateWithInteger(index);
+        HCMapRemoveObjectForKey(map, key);
+        HCRelease(key);
+    }
+    HCMapAddObjectReleasedForKeyReleased(map, HCStringCreateWithInteger(99), HCNumberCreateWithInteger(-99));
+    HCInteger previous = 101;
+    HCInteger iterationIndex = 0;
+    for (HCMapIterator i = HCMapIterationBegin(map); !HCMapIterationHasEnded(&i); HCMapIterationNext(&i)) {
+        HCInteger value = HCStringAsInteger(i.key);
+        ASSERT_TRUE(HCIsEqual(HCMapKeyAtIterationIndex(map, iterationIndex), i.key));
+        ASSERT_TRUE(HCIsEqual(HCMapObjectAtIterationIndex(map, iterationIndex), i.object));
+        ASSERT_TRUE(value < previous);
+        ASSERT_TRUE((100 - value) % 3 != 0);
+        previous = value;
+        iterationIndex++;
+    }
+    ASSERT_EQUAL(iterationIndex, HCMapCount(map));
+    ASSERT_EQUAL(HCNumberAsInteger(HCMapFirstObject(map)), -99);
+    HCRelease(map);
+}
+
+CTEST(HCMap, ValueIndex) {
+    HCMapRef map = HCMapCreateWithOptions(0, HCMapOptionIndexValues);
+    ASSERT_EQUAL(HCMapOptions(map), HCMapOptionIndexValues);
+    HCInteger count = 1000;
+    for (HCInteger index = 0; index < count; index++) {
+        HCMapAddObjectReleasedForKeyReleased(map, HCStringCreateWithInteger(index), HCNumberCreateWithInteger(index % 10));
+    }
+    HCMapAddObjectForCStringKey(map, "null", NULL);
+    HCNumberRef seven = HCNumberCreateWithInteger(7);
+    HCNumberRef missing = HCNumberCreateWithInteger(10);
+    ASSERT_TRUE(HCMapContainsObject(map, seven));
+    ASSERT_FALSE(HCMapContainsObject(map, missing));
+    ASSERT_FALSE(HCMapContainsObject(map, NULL));
+    ASSERT_EQUAL(HCStringAsInteger(HCMapKeyForObject(map, seven)) % 10, 7);
+    HCSetRef keys = HCMapKeysForObjectRetained(map, seven);
+    ASSERT_EQUAL(HCSetCount(keys), count / 10);
+    for (HCSetIterator i = HCSetIterationBegin(keys); !HCSetIterationHasEnded(&i); HCSetIterationNext(&i)) {
+        ASSERT_EQUAL(HCStringAsInteger(i.object) % 10, 7);
+    }
+    HCRelease(keys);
+    
+    // Replace and remove the objects equal to seven, shrinking the map as well
+    for (HCInteger index = 7; index < count; index += 10) {
+        HCStringRef key = HCStringCreateWithInteger(index);
+        if (index % 20 == 7) {
+            HCMapAddObjectReleasedForKey(map, key, HCNumberCreateWithInteger(-index));
+        }
+        else {
+            HCMapRemoveObjectForKey(map, key);
+        }
+        HCRelease(key);
+    }
+    for (HCInteger index = 0; index < count; index++) {
+        if (index % 10 != 7) {
+            HCStringRef key = HCStringCreateWithInteger(index);
+            HCMapRemoveObjectForKey(map, key);
+            HCRelease(key);
+        }
+    }
+    ASSERT_FALSE(HCMapContainsObject(map, seven));
+    keys = HCMapKeysForObjectRetained(map, seven);
+    ASSERT_TRUE(HCSetIsEmpty(keys));
+    HCRelease(keys);
+    for (HCInteger index = 7; index < count; index += 20) {
+        HCNumberRef number = HCNumberCreateWithInteger(-index);
+        HCStringRef key = HCMapKeyForObject(map, number);
+        ASSERT_EQUAL(HCStringAsInteger(key), index);
+        HCRelease(number);
+    }
+    HCMapClear(map);
+    ASSERT_FALSE(HCMapContainsObject(map, seven));
+    HCRelease(seven);
+    HCRelease(missing);
+    HCRelease(map);
+}
+
+CTEST(HCMap, ValueIndexMutatedObject) {
+    // Mutate indexed lists so that their hashes change, then remove and replace them
+    HCMapRef map = HCMapCreateWithOptions(0, HCMapOptionIndexValues);
+    HCListRef mutated = HCListCreate();
+    HCListRef equal = HCListCreate();
+    HCMapAddObjectReleasedForCStringKey(map, "mutated", HCRetain(mutated));
+    HCMapAddObjectReleasedForCStringKey(map, "equal", HCRetain(equal));
+    HCMapAddObjectReleasedForCStringKey(map, "other", HCListCreate());
+    HCListAddObjectReleased(mutated, HCNumberCreateWithInteger(1));
+    HCMapRemoveObjectForCStringKey(map, "mutated");
+    ASSERT_TRUE(HCMapContainsObject(map, equal));
+    ASSERT_FALSE(HCMapContainsObject(map, mutated));
+    HCListAddObjectReleased(equal, HCNumberCreateWithInteger(2));
+    HCMapAddObjectReleasedForCStringKey(map, "equal", HCNumberCreateWithInteger(3));
+    HCRelease(mutated);
+    HCRelease(equal);
+    
+    // The value index still agrees with the map after its lists are gone
+    HCListRef empty = HCListCreate();
+    ASSERT_TRUE(HCStringIsEqualToCString(HCMapKeyForObject(map, empty), "other"));
+    HCMapRemoveObjectForCStringKey(map, "other");
+    ASSERT_FALSE(HCMapContainsObject(map, empty));
+    HCRelease(empty);
+    HCNumberRef three = HCNumberCreateWithInteger(3);
+    ASSERT_TRUE(HCStringIsEqualToCString(HCMapKeyForObject(map, three), "equal"));
+    HCRelease(three);
+    HCRelease(map);
+}
+
+CTEST(HCMap, ValueIndexDuplicates) {
+    // Associate many keys with equal objects, then remove them in insertion order, which moves keys within the keys of the object
+    HCMapRef map = HCMapCreateWithOptions(0, HCMapOptionIndexValues);
+    HCInteger count = 100000;
+    for (HCInteger index = 0; index < count; index++) {
+        HCMapAddObjectReleasedForKeyReleased(map, HCNumberCreateWithInteger(index), HCStringCreateWithCString(index % 2 == 0 ? "even" : "odd"));
+    }
+    HCStringRef even = HCStringCreateWithCString("even");
+    HCSetRef keys = HCMapKeysForObjectRetained(map, even);
+    ASSERT_EQUAL(HCSetCount(keys), count / 2);
+    HCRelease(keys);
+    for (HCInteger index = 0; index < count; index += 2) {
+        HCNumberRef key = HCNumberCreateWithInteger(index);
+        ASSERT_TRUE(HCMapContainsObject(map, even));
+        HCMapRemoveObjectForKey(map, key);
+        HCRelease(key);
+        if (index % 10000 == 0) {
+            keys = HCMapKeysForObjectRetained(map, even);
+            ASSERT_EQUAL(HCSetCount(keys), (count - index) / 2 - 1);
+            HCRelease(keys);
+        }
+    }
+    ASSERT_FALSE(HCMapContainsObject(map, even));
+    ASSERT_NULL(HCMapKeyForObject(map, even));
+    HCStringRef odd = HCStringCreateWithCString("odd");
+    ASSERT_EQUAL(HCNumberAsInteger(HCMapKeyForObject(map, odd)) % 2, 1);
+    HCRelease(even);
+    HCRelease(odd);
+    HCRelease(map);
+}
+
+CTEST(HCMap, CStringKeys) {
+    HCMapRef map = HCMapCreateWithOptions(0, HCMapOptionIndexValues);
+    HCMapAddObjectReleasedForCStringKey(map, "one", HCNumberCreateWithInteger(1));
+    HCMapAddObjectReleasedForCStringKey(map, "two", HCNumberCreateWithInteger(2));
+    HCMapAddObjectReleasedForCStringKey(map, "one", HCNumberCreateWithInteger(-1));
+    ASSERT_EQUAL(HCMapCount(map), 2);
+    ASSERT_TRUE(HCMapContainsCStringKey(map, "one"));
+    ASSERT_FALSE(HCMapContainsCStringKey(map, "on"));
+    ASSERT_FALSE(HCMapContainsCStringKey(map, "three"));
+    ASSERT_EQUAL(HCNumberAsInteger(HCMapObjectForCStringKey(map, "one")), -1);
+    ASSERT_TRUE(HCStringIsEqualToCString(HCMapFirstKey(map), "one"));
+    HCNumberRef one = HCNumberCreateWithInteger(1);
+    HCNumberRef minusOne = HCNumberCreateWithInteger(-1);
+    ASSERT_FALSE(HCMapContainsObject(map, one));
+    ASSERT_TRUE(HCStringIsEqualToCString(HCMapKeyForObject(map, minusOne), "one"));
+    HCRelease(one);
+    HCRelease(minusOne);
+    HCNumberRef two = HCMapRemoveObjectRetainedForCStringKey(map, "two");
+    ASSERT_EQUAL(HCNumberAsInteger(two), 2);
+    HCRelease(two);
+    HCMapRemoveObjectForCStringKey(map, "one");
+    ASSERT_TRUE(HCMapIsEmpty(map));
+    HCRelease(map);
+}
@@ -18,3 +18,89 @@ CTEST(HCMap_Internal, IteratorStateSize) {
         ASSERT_FAIL();
     }
 }
+
+CTEST(HCMap_Internal, ReadingSkipsHoles) {
+    // Remove a few keys so that holes remain in the entries, then read without modifying the entries
+    HCMapRef map = HCMapCreate();
+    for (HCInteger index = 0; index < 100; index++) {
+        HCNumberRef key = HCNumberCreateWithInteger(index);
+        HCMapAddObjectReleasedForKey(map, key, HCStringCreateWithInteger(index));
+        HCRelease(key);
+    }
+    for (HCInteger index = 0; index < 10; index += 3) {
+        HCNumberRef key = HCNumberCreateWithInteger(index);
+        HCMapRemoveObjectForKey(map, key);
+        HCRelease(key);
+    }
+    HCMapEntry* entries = map->entries;
+    HCInteger entryCount = map->entryCount;
+    ASSERT_TRUE(entryCount > HCMapCount(map));
+    ASSERT_EQUAL(HCNumberAsInteger(HCMapFirstKey(map)), 1);
+    ASSERT_EQUAL(HCNumberAsInteger(HCMapLastKey(map)), 99);
+    ASSERT_EQUAL(HCNumberAsInteger(HCMapKeyAtIterationIndex(map, 4)), 7);
+    ASSERT_EQUAL(HCStringAsInteger(HCMapObjectAtIterationIndex(map, 5)), 8);
+    HCInteger iterationIndex = 0;
+    for (HCMapIterator i = HCMapIterationBegin(map); !HCMapIterationHasEnded(&i); HCMapIterationNext(&i)) {
+        ASSERT_TRUE(HCNumberAsInteger(i.key) % 3 != 0 || HCNumberAsInteger(i.key) > 9);
+        ASSERT_TRUE(HCMapKeyAtIterationIndex(map, iterationIndex) == i.key);
+        iterationIndex++;
+    }
+    ASSERT_EQUAL(iterationIndex, HCMapCount(map));
+    ASSERT_TRUE(HCMapIsEqual(map, map));
+    ASSERT_TRUE(map->entries == entries);
+    ASSERT_EQUAL(map->entryCount, entryCount);
+    
+    // Removing enough keys compacts the entries
+    for (HCInteger index = 10; index < 50; index++) {
+        HCNumberRef key = HCNumberCreateWithInteger(index);
+        HCMapRemoveObjectForKey(map, key);
+        HCRelease(key);
+    }
+    ASSERT_TRUE((map->entryCount - HCMapCount(map)) * 4 <= map->entryCount);
+    ASSERT_EQUAL(HCNumberAsInteger(HCMapFirstKey(map)), 1);
+    HCRelease(map);
+}
+
+CTEST(HCMap_Internal, IterationIndexAfterRemoval) {
+    // Remove the first key of a large map, which leaves a hole before every other entry
+    HCInteger count = 200000;
+    HCMapRef map = HCMapCreate();
+    for (HCInteger index = 0; index < count; index++) {
+        HCNumberRef key = HCNumberCreateWithInteger(index);
+        HCMapAddObjectForKey(map, key, key);
+        HCRelease(key);
+    }
+    HCNumberRef firstKey = HCNumberCreateWithInteger(0);
+    HCMapRemoveObjectForKey(map, firstKey);
+    HCRelease(firstKey);
+    ASSERT_TRUE(map->entryCount > HCMapCount(map));
+    ASSERT_NOT_NULL(map->liveCounts);
+    
+    // Read every iteration index, each of which examines a logarithmic number of live counts instead of scanning past the hole
+    for (HCInteger index = 0; index < HCMapCount(map); index++) {
+        ASSERT_EQUAL(HCNumberAsInteger(HCMapKeyAtIterationIndex(map, index)), index + 1);
+    }
+    
+    // Keep reading correctly as keys are added and more holes are left, until compaction discards the live counts
+    for (HCInteger index = count; index < count + 100; index++) {
+        HCNumberRef key = HCNumberCreateWithInteger(index);
+        HCMapAddObjectForKey(map, key, key);
+        HCRelease(key);
+    }
+    for (HCInteger index = 1; index < count; index += 7) {
+        HCNumberRef key = HCNumberCreateWithInteger(index);
+        HCMapRemoveObjectForKey(map, key);
+        HCRelease(key);
+    }
+    ASSERT_NOT_NULL(map->liveCounts);
+    HCInteger iterationIndex = 0;
+    for (HCMapIterator i = HCMapIterationBegin(map); !HCMapIterationHasEnded(&i); HCMapIterationNext(&i)) {
+        ASSERT_TRUE(HCMapKeyAtIterationIndex(map, iterationIndex) == i.key);
+        iterationIndex++;
+    }
+    ASSERT_EQUAL(iterationIndex, HCMapCount(map));
+    HCMapCompact(map);
+    ASSERT_NULL(map->liveCounts);
+    ASSERT_EQUAL(map->entryCount, HCMapCount(map));
+    HCRelease(map);
+}
@@ -186,3 +186,49 @@ CTEST(HCNumber, Print) {
     HCPrint(a, stdout); // TODO: Not to stdout
     HCRelease(a);
 }
+
+CTEST(HCNumber, Immediate) {
+    // Booleans and small integers are shared rather than allocated, and retain and release are no-ops
+    HCNumberRef a = HCNumberCreateWithInteger(200);
+    HCNumberRef b = HCNumberCreateWithInteger(200);
+    ASSERT_TRUE(a == b);
+    ASSERT_TRUE(HCRetain(a) == a);
+    HCRelease(a);
+    HCRelease(a);
+    HCRelease(b);
+    ASSERT_TRUE(HCNumberCreateWithBoolean(true) == HCNumberCreateWithBoolean(true));
+    ASSERT_FALSE(HCNumberCreateWithBoolean(true) == HCNumberCreateWithBoolean(false));
+    
+    // Immediate numbers behave as any other object
+    HCInteger values[] = { 0, 1, -1, 255, 256, -256, HCIntegerMaximum, HCIntegerMinimum, ((HCInteger)1 << 61) - 1, -((HCInteger)1 << 61), (HCInteger)1 << 61 };
+    for (HCInteger index = 0; index < (HCInteger)(sizeof(values) / sizeof(HCInteger)); index++) {
+        HCNumberRef number = HCNumberCreateWithInteger(values[index]);
+        ASSERT_TRUE(HCObjectTypeOf(number) == HCNumberType);
+        ASSERT_TRUE(HCObjectIsOfKind(number, HCObjectType));
+        ASSERT_TRUE(HCNumberIsInteger(number));
+        ASSERT_TRUE(HCNumberAsInteger(number) == values[index]);
+        HCNumberRef real = HCNumberCreateWithReal((HCReal)values[index]);
+        ASSERT_EQUAL(HCHashValue(number), HCIntegerHashValue(values[index]));
+        ASSERT_TRUE(HCIsEqual(number, number));
+        ASSERT_EQUAL(HCIsEqual(number, real), HCNumberIsEqual(number, real));
+        ASSERT_EQUAL(HCIsEqual(real, number), HCNumberIsEqual(number, real));
+        HCRelease(real);
+        HCRelease(number);
+    }
+    HCNumberRef falseNumber = HCNumberCreateWithBoolean(false);
+    ASSERT_TRUE(HCNumberIsBoolean(falseNumber));
+    ASSERT_FALSE(HCNumberAsBoolean(falseNumber));
+    ASSERT_TRUE(HCNumberAsBoolean(HCNumberCreateWithBoolean(true)));
+    
+    // Immediate numbers are never equal to objects of other types
+    HCStringRef string = HCStringCreateWithCString("0");
+    ASSERT_FALSE(HCIsEqual(falseNumber, string));
+    ASSERT_FALSE(HCIsEqual(string, falseNumber));
+    HCListRef list = HCListCreate();
+    HCListAddObjectReleased(list, HCNumberCreateWithInteger(7));
+    HCListAddObject(list, string);
+    ASSERT_TRUE(HCListContainsObject(list, HCNumberCreateWithInteger(7)));
+    ASSERT_FALSE(HCListContainsObject(list, falseNumber));
+    HCRelease(list);
+    HCRelease(string);
+}
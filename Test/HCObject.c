@@ -40,6 +40,28 @@ CTEST(HCObject, Type) {
     HCRelease(number);
 }
 
+CTEST(HCObject, TypeIdentifier) {
+    // Types defined by HollowCore are queried by identifier
+    ASSERT_TRUE(HCTypeIsOfKind(HCListType, HCObjectType));
+    ASSERT_FALSE(HCTypeIsOfKind(HCListType, HCSetType));
+    ASSERT_FALSE(HCTypeIsOfKind(HCObjectType, HCListType));
+    ASSERT_TRUE(HCTypeHasAncestor(HCMapType, HCObjectType));
+    ASSERT_FALSE(HCTypeHasAncestor(HCObjectType, HCObjectType));
+    ASSERT_FALSE(HCTypeIsOfType(HCStringType, HCDataType));
+    
+    // Types defined elsewhere are queried by name and ancestry
+    HCTypeData derived = { .name = "HCTestDerived", .ancestor = HCListType };
+    HCTypeData copy = { .name = "HCList", .ancestor = HCObjectType };
+    ASSERT_TRUE(HCTypeIsOfType(&copy, HCListType));
+    ASSERT_TRUE(HCTypeIsOfType(HCListType, &copy));
+    ASSERT_TRUE(HCTypeIsOfKind(&derived, HCListType));
+    ASSERT_TRUE(HCTypeIsOfKind(&derived, HCObjectType));
+    ASSERT_TRUE(HCTypeIsOfKind(&derived, &copy));
+    ASSERT_TRUE(HCTypeHasAncestor(&derived, HCObjectType));
+    ASSERT_FALSE(HCTypeIsOfKind(&derived, HCSetType));
+    ASSERT_FALSE(HCTypeIsOfKind(HCListType, &derived));
+}
+
 CTEST(HCObject, RetainRelease) {
     HCNumberRef number = HCNumberCreate();
     HCRetain(number);
@@ -47,9 +69,145 @@ CTEST(HCObject, RetainRelease) {
     HCRelease(number);
 }
 
+CTEST(HCObject, RetainReleaseArray) {
+    HCStringRef first = HCStringCreateWithCString("first");
+    HCListRef second = HCListCreate();
+    HCDataRef third = HCDataCreate();
+    HCNumberRef immediate = HCNumberCreateWithInteger(7);
+    HCRef objects[] = { first, first, first, NULL, second, immediate, first, third, third, second };
+    HCInteger count = sizeof(objects) / sizeof(HCRef);
+    HCRetainArray(objects, count);
+    HCReleaseArray(objects, count);
+    HCRetainArray(objects, count);
+    HCRelease(first);
+    HCRelease(second);
+    HCRelease(third);
+    HCRelease(immediate);
+    ASSERT_TRUE(HCStringIsEqual(first, first));
+    ASSERT_TRUE(HCListIsEmpty(second));
+    ASSERT_TRUE(HCDataIsEmpty(third));
+    HCReleaseArray(objects, count);
+    
+    HCObjectMarkThreadConfined(first = HCStringCreateWithCString("confined"));
+    HCRef confined[] = { first, first };
+    HCRetainArray(confined, 2);
+    HCReleaseArray(confined, 2);
+    HCRelease(first);
+    HCRetainArray(NULL, 0);
+    HCReleaseArray(NULL, 0);
+}
+
+static HCRef HCObjectTestCreateString(void* context) {
+    (void)context; // Unused
+    return HCStringCreateWithCString("arena");
+}
+
+static HCRef HCObjectTestCreateConfinedList(void* context) {
+    HCListRef list = HCListCreate();
+    for (HCInteger index = 0; index < *(HCInteger*)context; index++) {
+        HCStringRef string = HCStringCreateWithCString("confined");
+        HCListAddObject(list, string);
+        HCRelease(string);
+    }
+    return list;
+}
+
+CTEST(HCObject, ThreadConfined) {
+    HCStringRef string = HCStringCreateWithCString("string");
+    ASSERT_FALSE(HCObjectIsThreadConfined(string));
+    HCObjectMarkThreadConfined(string);
+    ASSERT_TRUE(HCObjectIsThreadConfined(string));
+    HCRetain(string);
+    HCRelease(string);
+    HCObjectMarkShared(string);
+    ASSERT_FALSE(HCObjectIsThreadConfined(string));
+    HCRelease(string);
+    
+    HCInteger count = 10;
+    HCListRef list = HCObjectCreateThreadConfined(HCObjectTestCreateConfinedList, &count);
+    ASSERT_TRUE(HCObjectIsThreadConfined(list));
+    ASSERT_EQUAL(HCListCount(list), count);
+    for (HCListIterator i = HCListIterationBegin(list); !HCListIterationHasEnded(&i); HCListIterationNext(&i)) {
+        ASSERT_TRUE(HCObjectIsThreadConfined(i.object));
+    }
+    HCStringRef created = HCStringCreateWithCString("unconfined");
+    ASSERT_FALSE(HCObjectIsThreadConfined(created));
+    HCRelease(created);
+    HCRelease(list);
+    
+    ASSERT_FALSE(HCObjectIsThreadConfined(NULL));
+    ASSERT_FALSE(HCObjectIsThreadConfined(HCNumberCreateWithInteger(1)));
+    
+    // Immortal objects are never confined, since they may be used by all threads
+    HCNumberRef number = HCNumberCreateWithInteger(1);
+    HCObjectMarkThreadConfined(number);
+    ASSERT_FALSE(HCObjectIsThreadConfined(number));
+    HCRelease(number);
+    HCArenaRef arena = HCArenaCreate();
+    HCStringRef arenaString = HCArenaCreateObject(arena, HCObjectTestCreateString, NULL);
+    HCObjectMarkThreadConfined(arenaString);
+    ASSERT_FALSE(HCObjectIsThreadConfined(arenaString));
+    HCObjectMarkShared(arenaString);
+    HCRelease(arena);
+}
+
+CTEST(HCObject, ReleaseQueue) {
+    ASSERT_FALSE(HCReleaseQueueIsDeferred());
+    HCReleaseQueueSetDeferred(true);
+    ASSERT_TRUE(HCReleaseQueueIsDeferred());
+    HCListRef list = HCListCreate();
+    for (HCInteger index = 0; index < 10; index++) {
+        HCListAddObjectReleased(list, HCStringCreateWithCString("queued"));
+    }
+    HCRef objects[] = { HCStringCreateWithCString("first"), HCDataCreate() };
+    HCReleaseArray(objects, 2);
+    HCRelease(list);
+    ASSERT_EQUAL(HCDrainReleaseQueue(), 3);
+    ASSERT_EQUAL(HCDrainReleaseQueue(), 0);
+    ASSERT_TRUE(HCReleaseQueueIsDeferred());
+    
+    ASSERT_FALSE(HCReleaseQueueIsReclaiming());
+    HCReleaseQueueStartReclaimer();
+    HCReleaseQueueStartReclaimer();
+    ASSERT_TRUE(HCReleaseQueueIsReclaiming());
+    for (HCInteger index = 0; index < 1000; index++) {
+        HCRelease(HCStringCreateWithCString("reclaimed"));
+    }
+    HCReleaseQueueStopReclaimer();
+    HCReleaseQueueStopReclaimer();
+    ASSERT_FALSE(HCReleaseQueueIsReclaiming());
+    ASSERT_EQUAL(HCDrainReleaseQueue(), 0);
+    HCReleaseQueueSetDeferred(false);
+}
+
+CTEST(HCObject, ReleaseQueueThreadConfined) {
+    // Thread-confined objects are destroyed on their thread even when it defers destruction, while the shared objects they held are queued
+    HCReleaseQueueSetDeferred(true);
+    HCInteger count = 10;
+    HCListRef list = HCObjectCreateThreadConfined(HCObjectTestCreateConfinedList, &count);
+    HCListAddObjectReleased(list, HCStringCreateWithCString("shared"));
+    HCRelease(list);
+    ASSERT_EQUAL(HCDrainReleaseQueue(), 1);
+    
+    // Released arrays of thread-confined and shared objects queue only the shared objects
+    HCListRef confined = HCObjectCreateThreadConfined(HCObjectTestCreateConfinedList, &count);
+    HCRef objects[] = { confined, HCStringCreateWithCString("shared"), HCObjectCreateThreadConfined(HCObjectTestCreateString, NULL) };
+    HCReleaseArray(objects, 3);
+    ASSERT_EQUAL(HCDrainReleaseQueue(), 1);
+    
+    // The reclaimer thread never receives thread-confined objects, whose references could only be released on this thread
+    HCReleaseQueueStartReclaimer();
+    for (HCInteger index = 0; index < 100; index++) {
+        HCRelease(HCObjectCreateThreadConfined(HCObjectTestCreateConfinedList, &count));
+    }
+    HCReleaseQueueStopReclaimer();
+    ASSERT_EQUAL(HCDrainReleaseQueue(), 0);
+    HCReleaseQueueSetDeferred(false);
+}
+
 CTEST(HCObject, EqualHash) {
-    HCNumberRef a = HCNumberCreate();
-    HCNumberRef b = HCNumberCreate();
+    HCNumberRef a = HCNumberCreateWithReal(0.0);
+    HCNumberRef b = HCNumberCreateWithReal(0.0);
     ASSERT_TRUE(HCObjectIsEqual((HCObjectRef)a, (HCObjectRef)a));
     ASSERT_FALSE(HCObjectIsEqual((HCObjectRef)a, (HCObjectRef)b));
     ASSERT_EQUAL(HCObjectHashValue((HCObjectRef)a), HCObjectHashValue((HCObjectRef)a));
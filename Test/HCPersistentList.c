@@ -0,0 +1,179 @@
+///
+/// @file HCPersistentList.c
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#include "ctest.h"
+#include "../Source/HollowCore.h"
+
+CTEST(HCPersistentList, Creation) {
+    HCPersistentListRef empty = HCPersistentListCreate();
+    ASSERT_TRUE(HCPersistentListIsEmpty(empty));
+    ASSERT_EQUAL(HCPersistentListCount(empty), 0);
+    ASSERT_NULL(HCPersistentListFirstObject(empty));
+    ASSERT_NULL(HCPersistentListLastObject(empty));
+    ASSERT_NULL(HCPersistentListObjectAtIndex(empty, 0));
+    HCPersistentListRef removed = HCPersistentListCreateByRemovingObject(empty);
+    ASSERT_TRUE(HCPersistentListIsEmpty(removed));
+    HCRelease(removed);
+    HCRelease(empty);
+}
+
+CTEST(HCPersistentList, AddRemoveMany) {
+    // Add enough objects for the trie to grow several levels, checking each version
+    HCInteger count = 40000;
+    HCPersistentListRef list = HCPersistentListCreate();
+    for (HCInteger index = 0; index < count; index++) {
+        HCNumberRef number = HCNumberCreateWithInteger(index);
+        HCPersistentListRef added = HCPersistentListCreateByAddingObject(list, number);
+        HCRelease(number);
+        ASSERT_EQUAL(HCPersistentListCount(list), index);
+        ASSERT_EQUAL(HCPersistentListCount(added), index + 1);
+        ASSERT_EQUAL(HCNumberAsInteger(HCPersistentListLastObject(added)), index);
+        HCRelease(list);
+        list = added;
+    }
+    for (HCInteger index = 0; index < count; index++) {
+        ASSERT_EQUAL(HCNumberAsInteger(HCPersistentListObjectAtIndex(list, index)), index);
+    }
+
+    // Remove all objects, keeping the trie valid as it shrinks
+    while (!HCPersistentListIsEmpty(list)) {
+        HCInteger lastIndex = HCPersistentListCount(list) - 1;
+        ASSERT_EQUAL(HCNumberAsInteger(HCPersistentListLastObject(list)), lastIndex);
+        ASSERT_EQUAL(HCNumberAsInteger(HCPersistentListFirstObject(list)), 0);
+        if (lastIndex % 997 == 0) {
+            ASSERT_EQUAL(HCNumberAsInteger(HCPersistentListObjectAtIndex(list, lastIndex / 2)), lastIndex / 2);
+        }
+        HCPersistentListRef removed = HCPersistentListCreateByRemovingObject(list);
+        HCRelease(list);
+        list = removed;
+    }
+    HCRelease(list);
+}
+
+CTEST(HCPersistentList, Versions) {
+    // Derived lists do not change the lists they are derived from
+    HCListRef source = HCListCreate();
+    for (HCInteger index = 0; index < 2000; index++) {
+        HCListAddObjectReleased(source, HCNumberCreateWithInteger(index));
+    }
+    HCPersistentListRef original = HCPersistentListCreateWithList(source);
+    ASSERT_EQUAL(HCPersistentListCount(original), 2000);
+    HCNumberRef replacement = HCNumberCreateWithInteger(-1);
+    HCPersistentListRef replacedTrie = HCPersistentListCreateByReplacingObjectAtIndex(original, 1000, replacement);
+    HCPersistentListRef replacedTail = HCPersistentListCreateByReplacingObjectAtIndex(original, 1999, replacement);
+    HCPersistentListRef replacedNothing = HCPersistentListCreateByReplacingObjectAtIndex(original, 2000, replacement);
+    HCPersistentListRef added = HCPersistentListCreateByAddingObject(original, replacement);
+    HCPersistentListRef removed = HCPersistentListCreateByRemovingObject(original);
+    HCRelease(replacement);
+    ASSERT_EQUAL(HCNumberAsInteger(HCPersistentListObjectAtIndex(replacedTrie, 1000)), -1);
+    ASSERT_EQUAL(HCNumberAsInteger(HCPersistentListObjectAtIndex(replacedTrie, 999)), 999);
+    ASSERT_EQUAL(HCNumberAsInteger(HCPersistentListObjectAtIndex(replacedTail, 1999)), -1);
+    ASSERT_EQUAL(HCNumberAsInteger(HCPersistentListLastObject(added)), -1);
+    ASSERT_EQUAL(HCPersistentListCount(removed), 1999);
+    ASSERT_TRUE(HCPersistentListIsEqual(replacedNothing, original));
+    for (HCInteger index = 0; index < 2000; index++) {
+        ASSERT_EQUAL(HCNumberAsInteger(HCPersistentListObjectAtIndex(original, index)), index);
+    }
+    HCRelease(replacedTrie);
+    HCRelease(replacedTail);
+    HCRelease(replacedNothing);
+    HCRelease(added);
+    HCRelease(removed);
+
+    // Converting back to a list produces the same elements
+    HCListRef list = HCPersistentListCreateList(original);
+    ASSERT_TRUE(HCListIsEqual(list, source));
+    HCRelease(list);
+    HCRelease(original);
+    HCRelease(source);
+}
+
+CTEST(HCPersistentList, EqualHash) {
+    HCListRef source = HCListCreate();
+    for (HCInteger index = 0; index < 100; index++) {
+        HCListAddObjectReleased(source, HCNumberCreateWithInteger(index));
+    }
+    HCPersistentListRef a = HCPersistentListCreateWithList(source);
+    HCPersistentListRef b = HCPersistentListCreate();
+    for (HCInteger index = 0; index < 100; index++) {
+        HCPersistentListRef added = HCPersistentListCreateByAddingObject(b, HCListObjectAtIndex(source, index));
+        HCRelease(b);
+        b = added;
+    }
+    HCPersistentListRef c = HCPersistentListCreateByRemovingObject(a);
+    ASSERT_TRUE(HCPersistentListIsEqual(a, a));
+    ASSERT_TRUE(HCPersistentListIsEqual(a, b));
+    ASSERT_TRUE(HCPersistentListIsEqual(b, a));
+    ASSERT_FALSE(HCPersistentListIsEqual(a, c));
+    ASSERT_TRUE(HCIsEqual(a, b));
+    ASSERT_EQUAL(HCPersistentListHashValue(a), HCPersistentListHashValue(b));
+    ASSERT_EQUAL(HCPersistentListHashValue(a), HCListHashValue(source));
+    HCRelease(a);
+    HCRelease(b);
+    HCRelease(c);
+    HCRelease(source);
+}
+
+CTEST(HCPersistentList, Print) {
+    HCPersistentListRef empty = HCPersistentListCreate();
+    HCPersistentListRef list = HCPersistentListCreateByAddingObject(empty, HCNumberCreateWithInteger(1));
+    HCPersistentListPrint(list, stdout); // TODO: Not to stdout
+    HCPrint(list, stdout); // TODO: Not to stdout
+    HCRelease(list);
+    HCRelease(empty);
+}
+
+void HCPersistentListTestSum(void* context, HCPersistentListRef list, HCInteger index, HCRef object) {
+    (void)list; // Unused
+    ASSERT_EQUAL(HCNumberAsInteger(object), index);
+    *(HCInteger*)context += HCNumberAsInteger(object);
+}
+
+CTEST(HCPersistentList, ForEach) {
+    HCListRef source = HCListCreate();
+    for (HCInteger index = 0; index < 1000; index++) {
+        HCListAddObjectReleased(source, HCNumberCreateWithInteger(index));
+    }
+    HCPersistentListRef list = HCPersistentListCreateWithList(source);
+    HCInteger sum = 0;
+    HCPersistentListForEach(list, HCPersistentListTestSum, &sum);
+    ASSERT_EQUAL(sum, 999 * 1000 / 2);
+    HCRelease(list);
+    HCRelease(source);
+}
+
+static void HCPersistentListTestRead(void* context) {
+    HCPersistentListRef list = context;
+    HCInteger sum = 0;
+    for (HCInteger iteration = 0; iteration < 100; iteration++) {
+        HCPersistentListForEach(list, HCPersistentListTestSum, &sum);
+    }
+}
+
+CTEST(HCPersistentList, Threads) {
+    // Read snapshots on other threads while newer versions are derived from them and the snapshots are released
+    HCPersistentListRef list = HCPersistentListCreate();
+    for (HCInteger iteration = 0; iteration < 20; iteration++) {
+        HCPersistentListRef snapshot = HCRetain(list);
+        HCThreadRef thread = HCThreadCreate(HCPersistentListTestRead, snapshot);
+        HCThreadExecute(thread);
+        for (HCInteger index = 0; index < 100; index++) {
+            HCNumberRef number = HCNumberCreateWithInteger(HCPersistentListCount(list));
+            HCPersistentListRef added = HCPersistentListCreateByAddingObject(list, number);
+            HCRelease(number);
+            HCRelease(list);
+            list = added;
+        }
+        HCThreadJoin(thread);
+        HCRelease(thread);
+        HCRelease(snapshot);
+    }
+    ASSERT_EQUAL(HCPersistentListCount(list), 2000);
+    HCRelease(list);
+}
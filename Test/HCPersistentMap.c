@@ -0,0 +1,196 @@
+///
+/// @file HCPersistentMap.c
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#include "ctest.h"
+#include "../Source/HollowCore.h"
+
+CTEST(HCPersistentMap, Creation) {
+    HCPersistentMapRef empty = HCPersistentMapCreate();
+    ASSERT_TRUE(HCPersistentMapIsEmpty(empty));
+    ASSERT_EQUAL(HCPersistentMapCount(empty), 0);
+    HCStringRef key = HCStringCreateWithCString("key");
+    ASSERT_FALSE(HCPersistentMapContainsKey(empty, key));
+    ASSERT_NULL(HCPersistentMapObjectForKey(empty, key));
+    HCPersistentMapRef removed = HCPersistentMapCreateByRemovingObjectForKey(empty, key);
+    ASSERT_TRUE(removed == empty);
+    HCRelease(removed);
+    HCRelease(key);
+    HCRelease(empty);
+}
+
+CTEST(HCPersistentMap, AddRemoveMany) {
+    // Add pairs, deriving a map that replaces the object of every tenth key, checking each version
+    HCInteger count = 20000;
+    HCPersistentMapRef map = HCPersistentMapCreate();
+    for (HCInteger index = 0; index < count; index++) {
+        HCNumberRef key = HCNumberCreateWithInteger(index);
+        HCStringRef object = HCStringCreateWithInteger(index);
+        HCPersistentMapRef added = HCPersistentMapCreateByAddingObjectForKey(map, key, object);
+        ASSERT_EQUAL(HCPersistentMapCount(added), index + 1);
+        ASSERT_FALSE(HCPersistentMapContainsKey(map, key));
+        ASSERT_TRUE(HCPersistentMapObjectForKey(added, key) == object);
+        HCRelease(map);
+        map = added;
+        if (index % 10 == 0) {
+            HCPersistentMapRef replaced = HCPersistentMapCreateByAddingObjectForKey(map, key, key);
+            ASSERT_EQUAL(HCPersistentMapCount(replaced), index + 1);
+            ASSERT_TRUE(HCPersistentMapObjectForKey(replaced, key) == key);
+            ASSERT_TRUE(HCPersistentMapObjectForKey(map, key) == object);
+            HCRelease(replaced);
+        }
+        HCRelease(key);
+        HCRelease(object);
+    }
+    for (HCInteger index = 0; index < count; index++) {
+        HCNumberRef key = HCNumberCreateWithInteger(index);
+        HCRef object = HCPersistentMapObjectForKey(map, key);
+        ASSERT_EQUAL(HCStringAsInteger(object), index);
+        HCRelease(key);
+    }
+
+    // Remove all pairs, in a different order than they were added
+    for (HCInteger step = 0; step < count; step++) {
+        HCNumberRef key = HCNumberCreateWithInteger((step * 7919) % count);
+        HCPersistentMapRef removed = HCPersistentMapCreateByRemovingObjectForKey(map, key);
+        ASSERT_EQUAL(HCPersistentMapCount(removed), count - step - 1);
+        ASSERT_TRUE(HCPersistentMapContainsKey(map, key));
+        ASSERT_FALSE(HCPersistentMapContainsKey(removed, key));
+        HCRelease(map);
+        map = removed;
+        HCRelease(key);
+    }
+    ASSERT_TRUE(HCPersistentMapIsEmpty(map));
+    HCRelease(map);
+}
+
+CTEST(HCPersistentMap, Collisions) {
+    // Pair each fractional real key with the integer key equal to its hash value, since the two are not equal
+    HCInteger count = 100;
+    HCPersistentMapRef map = HCPersistentMapCreate();
+    for (HCInteger index = 0; index < count; index++) {
+        HCReal real = 0.5 + (HCReal)index;
+        HCInteger bits = HCRealHashValue(real);
+        HCNumberRef realKey = HCNumberCreateWithReal(real);
+        HCNumberRef integerKey = HCNumberCreateWithInteger(bits);
+        ASSERT_EQUAL(HCHashValue(realKey), HCHashValue(integerKey));
+        ASSERT_FALSE(HCIsEqual(realKey, integerKey));
+        HCPersistentMapRef addedReal = HCPersistentMapCreateByAddingObjectForKey(map, realKey, realKey);
+        HCPersistentMapRef addedInteger = HCPersistentMapCreateByAddingObjectForKey(addedReal, integerKey, integerKey);
+        ASSERT_EQUAL(HCPersistentMapCount(addedInteger), (index + 1) * 2);
+        ASSERT_TRUE(HCPersistentMapObjectForKey(addedInteger, realKey) == realKey);
+        ASSERT_TRUE(HCPersistentMapObjectForKey(addedInteger, integerKey) == integerKey);
+        ASSERT_FALSE(HCPersistentMapContainsKey(addedReal, integerKey));
+        HCRelease(map);
+        HCRelease(addedReal);
+        map = addedInteger;
+        HCRelease(realKey);
+        HCRelease(integerKey);
+    }
+
+    // Remove one key of each colliding pair, leaving the other reachable
+    for (HCInteger index = 0; index < count; index++) {
+        HCNumberRef realKey = HCNumberCreateWithReal(0.5 + (HCReal)index);
+        HCPersistentMapRef removed = HCPersistentMapCreateByRemovingObjectForKey(map, realKey);
+        ASSERT_EQUAL(HCPersistentMapCount(removed), count * 2 - index - 1);
+        ASSERT_FALSE(HCPersistentMapContainsKey(removed, realKey));
+        HCRelease(map);
+        map = removed;
+        HCRelease(realKey);
+    }
+    for (HCInteger index = 0; index < count; index++) {
+        HCReal real = 0.5 + (HCReal)index;
+        HCInteger bits = HCRealHashValue(real);
+        HCNumberRef integerKey = HCNumberCreateWithInteger(bits);
+        ASSERT_TRUE(HCIsEqual(HCPersistentMapObjectForKey(map, integerKey), integerKey));
+        HCRelease(integerKey);
+    }
+    HCRelease(map);
+}
+
+CTEST(HCPersistentMap, Conversion) {
+    HCMapRef source = HCMapCreate();
+    for (HCInteger index = 0; index < 1000; index++) {
+        HCNumberRef key = HCNumberCreateWithInteger(index);
+        HCMapAddObjectReleasedForKey(source, key, HCStringCreateWithInteger(index));
+        HCRelease(key);
+    }
+    HCPersistentMapRef map = HCPersistentMapCreateWithMap(source);
+    ASSERT_EQUAL(HCPersistentMapCount(map), 1000);
+    HCMapRef converted = HCPersistentMapCreateMap(map);
+    ASSERT_TRUE(HCMapIsEqual(converted, source));
+    HCRelease(converted);
+    HCRelease(map);
+    HCRelease(source);
+}
+
+CTEST(HCPersistentMap, EqualHash) {
+    // Maps built in different orders are equal
+    HCPersistentMapRef a = HCPersistentMapCreate();
+    HCPersistentMapRef b = HCPersistentMapCreate();
+    for (HCInteger index = 0; index < 500; index++) {
+        HCNumberRef aKey = HCNumberCreateWithInteger(index);
+        HCNumberRef bKey = HCNumberCreateWithInteger(499 - index);
+        HCPersistentMapRef aAdded = HCPersistentMapCreateByAddingObjectForKey(a, aKey, aKey);
+        HCPersistentMapRef bAdded = HCPersistentMapCreateByAddingObjectForKey(b, bKey, bKey);
+        HCRelease(a);
+        HCRelease(b);
+        a = aAdded;
+        b = bAdded;
+        HCRelease(aKey);
+        HCRelease(bKey);
+    }
+    HCNumberRef key = HCNumberCreateWithInteger(0);
+    HCNumberRef object = HCNumberCreateWithInteger(1);
+    HCPersistentMapRef c = HCPersistentMapCreateByAddingObjectForKey(a, key, object);
+    HCPersistentMapRef d = HCPersistentMapCreateByRemovingObjectForKey(a, key);
+    ASSERT_TRUE(HCPersistentMapIsEqual(a, a));
+    ASSERT_TRUE(HCPersistentMapIsEqual(a, b));
+    ASSERT_TRUE(HCIsEqual(b, a));
+    ASSERT_FALSE(HCPersistentMapIsEqual(a, c));
+    ASSERT_FALSE(HCPersistentMapIsEqual(a, d));
+    ASSERT_EQUAL(HCPersistentMapHashValue(a), HCPersistentMapHashValue(b));
+    ASSERT_EQUAL(HCPersistentMapHashValue(a), HCPersistentMapHashValue(c));
+    HCRelease(a);
+    HCRelease(b);
+    HCRelease(c);
+    HCRelease(d);
+    HCRelease(key);
+    HCRelease(object);
+}
+
+CTEST(HCPersistentMap, Print) {
+    HCPersistentMapRef empty = HCPersistentMapCreate();
+    HCNumberRef key = HCNumberCreateWithInteger(1);
+    HCPersistentMapRef map = HCPersistentMapCreateByAddingObjectForKey(empty, key, key);
+    HCPersistentMapPrint(map, stdout); // TODO: Not to stdout
+    HCPrint(map, stdout); // TODO: Not to stdout
+    HCRelease(map);
+    HCRelease(key);
+    HCRelease(empty);
+}
+
+void HCPersistentMapTestSum(void* context, HCPersistentMapRef map, HCRef key, HCRef object) {
+    ASSERT_TRUE(HCPersistentMapObjectForKey(map, key) == object);
+    *(HCInteger*)context += HCNumberAsInteger(key);
+}
+
+CTEST(HCPersistentMap, ForEach) {
+    HCPersistentMapRef map = HCPersistentMapCreate();
+    for (HCInteger index = 0; index < 1000; index++) {
+        HCNumberRef key = HCNumberCreateWithInteger(index);
+        HCPersistentMapRef added = HCPersistentMapCreateByAddingObjectForKey(map, key, key);
+        HCRelease(map);
+        map = added;
+        HCRelease(key);
+    }
+    HCInteger sum = 0;
+    HCPersistentMapForEach(map, HCPersistentMapTestSum, &sum);
+    ASSERT_EQUAL(sum, 999 * 1000 / 2);
+    HCRelease(map);
+}
@@ -339,3 +339,86 @@ CTEST(HCSet, IterationLoop) {
 
     HCRelease(set);
 }
+
+CTEST(HCSet, Growth) {
+    HCInteger count = 10000;
+    HCSetRef set = HCSetCreateWithCapacity(0);
+    for (HCInteger index = 0; index < count; index++) {
+        HCSetAddObjectReleased(set, HCNumberCreateWithInteger(index * 7));
+    }
+    ASSERT_EQUAL(HCSetCount(set), count);
+    for (HCInteger index = 0; index < count; index += 2) {
+        HCNumberRef number = HCNumberCreateWithInteger(index * 7);
+        HCSetRemoveObject(set, number);
+        HCRelease(number);
+    }
+    ASSERT_EQUAL(HCSetCount(set), count / 2);
+    for (HCInteger index = 0; index < count; index++) {
+        HCNumberRef number = HCNumberCreateWithInteger(index * 7);
+        ASSERT_EQUAL(HCSetContainsObject(set, number), index % 2 == 1);
+        HCRelease(number);
+    }
+    HCInteger iterationCount = 0;
+    for (HCSetIterator i = HCSetIterationBegin(set); !HCSetIterationHasEnded(&i); HCSetIterationNext(&i)) {
+        ASSERT_EQUAL(HCNumberAsInteger(i.object) % 14, 7);
+        iterationCount++;
+    }
+    ASSERT_EQUAL(iterationCount, count / 2);
+    HCRelease(set);
+}
+
+CTEST(HCSet, IterationIndexAfterRemoval) {
+    HCSetRef set = HCSetCreate();
+    for (HCInteger index = 0; index < 100; index++) {
+        HCSetAddObjectReleased(set, HCNumberCreateWithInteger(index));
+    }
+    for (HCInteger index = 0; index < 10; index += 3) {
+        HCNumberRef number = HCNumberCreateWithInteger(index);
+        HCSetRemoveObject(set, number);
+        HCRelease(number);
+    }
+    ASSERT_EQUAL(HCNumberAsInteger(HCSetFirstObject(set)), 1);
+    ASSERT_EQUAL(HCNumberAsInteger(HCSetLastObject(set)), 99);
+    ASSERT_EQUAL(HCNumberAsInteger(HCSetObjectAtIterationIndex(set, 4)), 7);
+    ASSERT_NULL(HCSetObjectAtIterationIndex(set, HCSetCount(set)));
+    for (HCInteger index = 100; index < 110; index++) {
+        HCSetAddObjectReleased(set, HCNumberCreateWithInteger(index));
+    }
+    ASSERT_EQUAL(HCNumberAsInteger(HCSetObjectAtIterationIndex(set, 95)), 99);
+    ASSERT_EQUAL(HCNumberAsInteger(HCSetObjectAtIterationIndex(set, 96)), 100);
+    HCInteger iterationIndex = 0;
+    for (HCSetIterator i = HCSetIterationBegin(set); !HCSetIterationHasEnded(&i); HCSetIterationNext(&i)) {
+        ASSERT_TRUE(HCSetObjectAtIterationIndex(set, iterationIndex) == i.object);
+        iterationIndex++;
+    }
+    ASSERT_EQUAL(iterationIndex, HCSetCount(set));
+    HCRelease(set);
+}
+
+CTEST(HCSet, InsertionOrder) {
+    HCSetRef set = HCSetCreate();
+    for (HCInteger index = 100; index > 0; index--) {
+        HCSetAddObjectReleased(set, HCNumberCreateWithInteger(index));
+    }
+    for (HCInteger index = 100; index > 0; index -= 3) {
+        HCNumberRef number = HCNumberCreateWithInteger(index);
+        HCSetRemoveObject(set, number);
+        HCRelease(number);
+    }
+    HCSetAddObjectReleased(set, HCNumberCreateWithInteger(1000));
+    HCInteger previous = 101;
+    HCInteger iterationIndex = 0;
+    for (HCSetIterator i = HCSetIterationBegin(set); !HCSetIterationHasEnded(&i); HCSetIterationNext(&i)) {
+        HCInteger value = HCNumberAsInteger(i.object);
+        ASSERT_TRUE(HCIsEqual(HCSetObjectAtIterationIndex(set, iterationIndex), i.object));
+        if (value != 1000) {
+            ASSERT_TRUE(value < previous);
+            ASSERT_TRUE((100 - value) % 3 != 0);
+            previous = value;
+        }
+        iterationIndex++;
+    }
+    ASSERT_EQUAL(iterationIndex, HCSetCount(set));
+    ASSERT_EQUAL(HCNumberAsInteger(HCSetObjectAtIterationIndex(set, HCSetCount(set) - 1)), 1000);
+    HCRelease(set);
+}
@@ -63,6 +63,51 @@ CTEST(HCString, EqualHash) {
     HCRelease(c);
 }
 
+CTEST(HCString, Interned) {
+    HCStringRef a = HCStringCreateWithCString("interned key");
+    HCStringRef b = HCStringCreateInterned(a);
+    HCStringRef c = HCStringCreateInternedWithCString("interned key");
+    HCStringRef d = HCStringCreateInternedWithCString("other key");
+    ASSERT_FALSE(HCStringIsInterned(a));
+    ASSERT_TRUE(HCStringIsInterned(b));
+    ASSERT_TRUE(b == c);
+    ASSERT_TRUE(HCStringCreateInterned(b) == b);
+    HCRelease(b);
+    ASSERT_TRUE(HCStringIsEqual(a, b));
+    ASSERT_TRUE(HCStringIsEqual(b, a));
+    ASSERT_TRUE(HCStringIsEqual(b, c));
+    ASSERT_FALSE(HCStringIsEqual(c, d));
+    ASSERT_EQUAL(HCStringHashValue(a), HCStringHashValue(c));
+    ASSERT_TRUE(HCStringIsEqualToCString(d, "other key"));
+    HCRelease(a);
+    HCRelease(b);
+    HCRelease(c);
+    HCRelease(d);
+}
+
+static HCRef HCStringTestCreateInterned(void* context) {
+    return HCStringCreateInternedWithCString(context);
+}
+
+CTEST(HCString, InternedInArenaAndThreadConfined) {
+    // Strings interned while creating arena or thread-confined objects outlive the arena and are shared
+    HCArenaRef arena = HCArenaCreate();
+    HCStringRef a = HCArenaCreateObject(arena, HCStringTestCreateInterned, "arena interned key");
+    ASSERT_FALSE(HCObjectIsThreadConfined(a));
+    HCRelease(arena);
+    HCStringRef b = HCStringCreateInternedWithCString("arena interned key");
+    HCStringRef c = HCStringCreateInternedWithCString("key interned after arena");
+    ASSERT_TRUE(a == b);
+    ASSERT_TRUE(HCStringIsEqualToCString(a, "arena interned key"));
+    ASSERT_TRUE(HCStringIsEqualToCString(c, "key interned after arena"));
+    HCStringRef d = HCObjectCreateThreadConfined(HCStringTestCreateInterned, "confined interned key");
+    ASSERT_FALSE(HCObjectIsThreadConfined(d));
+    HCRelease(a);
+    HCRelease(b);
+    HCRelease(c);
+    HCRelease(d);
+}
+
 CTEST(HCString, Print) {
     HCStringRef string = HCStringCreateWithCString("Four score and seven years ago");
     HCStringPrint(string, stdout); // TODO: Not to stdout
@@ -110,6 +155,74 @@ CTEST(HCString, CodePoints) {
     HCRelease(complexString);
 }
 
+CTEST(HCString, CodePointIndex) {
+    // Build a string of 1000 code points cycling through 1, 2, 3, and 4 code unit encodings, with an invalid code unit every 100 code points
+    HCStringCodePoint expected[1000];
+    HCByte bytes[4000];
+    HCInteger size = 0;
+    for (HCInteger index = 0; index < 1000; index++) {
+        if (index % 100 == 99) {
+            bytes[size++] = 0xFF;
+            expected[index] = 0xFFFD;
+            continue;
+        }
+        switch (index % 4) {
+            case 0: bytes[size++] = 'a' + index % 26; expected[index] = 'a' + index % 26; break;
+            case 1: bytes[size++] = 0xC3; bytes[size++] = 0xA9; expected[index] = 0xE9; break; // é
+            case 2: bytes[size++] = 0xE2; bytes[size++] = 0x8A; bytes[size++] = 0xAD; expected[index] = 0x22AD; break; // ⊭
+            case 3: bytes[size++] = 0xF0; bytes[size++] = 0x9F; bytes[size++] = 0x98; bytes[size++] = 0x80; expected[index] = 0x1F600; break; // 😀
+        }
+    }
+    HCStringRef string = HCStringCreateWithBytes(HCStringEncodingUTF8, size, bytes);
+    ASSERT_EQUAL(HCStringCodePointCount(string), 1000);
+    for (HCInteger index = 999; index >= 0; index -= 7) {
+        ASSERT_EQUAL(HCStringCodePointAtIndex(string, index), expected[index]);
+    }
+    HCStringCodePoint extracted[100];
+    HCStringExtractCodePoints(string, 950, 100, extracted);
+    for (HCInteger index = 0; index < 100; index++) {
+        ASSERT_EQUAL(extracted[index], index < 50 ? expected[950 + index] : 0xFFFD);
+    }
+    HCRelease(string);
+}
+
+void HCStringTestReadCodePoints(void* context) {
+    HCStringRef string = context;
+    ASSERT_EQUAL(HCStringCodePointCount(string), 1000);
+    for (HCInteger index = 0; index < 1000; index++) {
+        ASSERT_EQUAL(HCStringCodePointAtIndex(string, index), index % 2 == 0 ? 'a' : 0xE9);
+    }
+}
+
+CTEST(HCString, CodePointIndexThreads) {
+    // Read the code points of new non-ASCII strings from several threads at once, so that their indexes are built concurrently
+    HCByte bytes[1500];
+    HCInteger size = 0;
+    for (HCInteger index = 0; index < 1000; index++) {
+        if (index % 2 == 0) {
+            bytes[size++] = 'a';
+        }
+        else {
+            bytes[size++] = 0xC3;
+            bytes[size++] = 0xA9;
+        }
+    }
+    for (HCInteger iteration = 0; iteration < 20; iteration++) {
+        HCStringRef string = HCStringCreateWithBytes(HCStringEncodingUTF8, size, bytes);
+        HCThreadRef threads[4];
+        for (HCInteger index = 0; index < 4; index++) {
+            threads[index] = HCThreadCreate(HCStringTestReadCodePoints, string);
+            HCThreadExecute(threads[index]);
+        }
+        HCStringTestReadCodePoints(string);
+        for (HCInteger index = 0; index < 4; index++) {
+            HCThreadJoin(threads[index]);
+            HCRelease(threads[index]);
+        }
+        HCRelease(string);
+    }
+}
+
 CTEST(HCString, ExtractCodeUnits) {
     HCStringRef simpleString = HCStringCreateWithCString("ABCD");
     HCStringCodeUnit extracted[2];
@@ -0,0 +1,84 @@
+///
+/// @file HCString_Internal.c
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#include "ctest.h"
+#include "../Source/HollowCore.h"
+#include "../Source/Data/HCString_Internal.h"
+#include <string.h>
+
+static HCInteger HCStringInternalTestFill(HCStringCodeUnit* codeUnits, HCInteger capacity, uint32_t seed, HCBoolean corrupt) {
+    // Fill with runs of ASCII and encoded code points of all lengths, optionally replacing some code units with random values
+    static const HCStringCodeUnit pieces[][5] = { "a", "Z", "\xC3\xA9", "\xE2\x8A\xAD", "\xED\x9F\xBF", "\xEF\xBF\xBD", "\xF0\x9F\x98\x80", "\xF4\x8F\xBF\xBF" };
+    HCInteger size = 0;
+    while (true) {
+        seed = seed * 1103515245 + 12345;
+        const HCStringCodeUnit* piece = pieces[(seed >> 16) % (seed % 3 == 0 ? 8 : 2)];
+        HCInteger pieceSize = strlen((const char*)piece);
+        if (size + pieceSize > capacity) {
+            break;
+        }
+        memcpy(codeUnits + size, piece, pieceSize);
+        size += pieceSize;
+    }
+    if (corrupt && size > 0) {
+        seed = seed * 1103515245 + 12345;
+        codeUnits[(seed >> 8) % size] = (HCStringCodeUnit)(seed >> 24);
+    }
+    return size;
+}
+
+CTEST(HCString_Internal, ASCIIKernels) {
+    HCStringCodeUnit codeUnits[300];
+    HCStringCodePoint codePoints[300];
+    HCStringCodePoint scalarCodePoints[300];
+    memset(codeUnits, 'x', sizeof(codeUnits));
+    for (HCInteger size = 0; size <= (HCInteger)sizeof(codeUnits); size++) {
+        ASSERT_TRUE(HCStringCodeUnitsAreASCII(codeUnits, size));
+        ASSERT_EQUAL(HCStringConvertASCIICodeUnits(codeUnits, size, codePoints), size);
+    }
+    for (HCInteger position = 0; position < (HCInteger)sizeof(codeUnits); position++) {
+        codeUnits[position] = 0xC3;
+        ASSERT_FALSE(HCStringCodeUnitsAreASCII(codeUnits, sizeof(codeUnits)));
+        ASSERT_TRUE(HCStringCodeUnitsAreASCII(codeUnits, position));
+        ASSERT_EQUAL(HCStringConvertASCIICodeUnits(codeUnits, sizeof(codeUnits), codePoints), position);
+        ASSERT_EQUAL(HCStringConvertASCIICodeUnitsScalar(codeUnits, sizeof(codeUnits), scalarCodePoints), position);
+        ASSERT_DATA((const unsigned char*)scalarCodePoints, position * sizeof(HCStringCodePoint), (const unsigned char*)codePoints, position * sizeof(HCStringCodePoint));
+        codeUnits[position] = 'x';
+    }
+}
+
+CTEST(HCString_Internal, ValidationKernels) {
+    HCStringCodeUnit codeUnits[500];
+    HCInteger checkpoints[500 / HCStringCodePointCheckpointIntervalStatic + 1];
+    HCInteger scalarCheckpoints[500 / HCStringCodePointCheckpointIntervalStatic + 1];
+    for (uint32_t seed = 0; seed < 2000; seed++) {
+        HCInteger size = HCStringInternalTestFill(codeUnits, 1 + seed % 500, seed, seed % 2 == 1);
+        for (HCInteger prefix = size; prefix >= 0 && prefix > size - 4; prefix--) {
+            HCBoolean valid = HCStringCodeUnitsAreValidScalar(codeUnits, prefix);
+            ASSERT_EQUAL(HCStringCodeUnitsAreValid(codeUnits, prefix), valid);
+            if (valid) {
+                HCInteger count = HCStringIndexCodePoints(codeUnits, prefix, checkpoints);
+                ASSERT_EQUAL(count, HCStringIndexCodePointsScalar(codeUnits, prefix, scalarCheckpoints));
+                HCInteger checkpointCount = (count + HCStringCodePointCheckpointIntervalStatic - 1) / HCStringCodePointCheckpointIntervalStatic;
+                ASSERT_DATA((const unsigned char*)scalarCheckpoints, checkpointCount * sizeof(HCInteger), (const unsigned char*)checkpoints, checkpointCount * sizeof(HCInteger));
+            }
+        }
+    }
+
+    // Reject overlong encodings, surrogates, code points beyond the Unicode range, and stray or missing continuations
+    const char* invalid[] = { "\xC0\xAF", "\xE0\x80\xAF", "\xF0\x80\x80\xAF", "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\x80", "\xC3", "\xE2\x8A", "\xC3\xA9\xA9" };
+    for (HCInteger index = 0; index < (HCInteger)(sizeof(invalid) / sizeof(const char*)); index++) {
+        HCStringCodeUnit padded[64];
+        memset(padded, 'x', sizeof(padded));
+        memcpy(padded + 40, invalid[index], strlen(invalid[index]));
+        ASSERT_FALSE(HCStringCodeUnitsAreValid((const HCStringCodeUnit*)invalid[index], strlen(invalid[index])));
+        ASSERT_FALSE(HCStringCodeUnitsAreValid(padded, sizeof(padded)));
+        ASSERT_FALSE(HCStringCodeUnitsAreValidScalar(padded, sizeof(padded)));
+    }
+}
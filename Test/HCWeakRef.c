@@ -0,0 +1,143 @@
+///
+/// @file HCWeakRef.c
+/// @ingroup HollowCore
+///
+/// @author Matt Stoker
+/// @date 10/17/26
+/// @copyright © 2020 HollowCore Contributors. MIT License.
+///
+
+#include "ctest.h"
+#include "../Source/HollowCore.h"
+
+CTEST(HCWeakRef, Creation) {
+    HCStringRef string = HCStringCreateWithCString("weak");
+    HCWeakRefRef weak = HCWeakRefCreate(string);
+    ASSERT_FALSE(HCWeakRefIsCleared(weak));
+    HCStringRef loaded = HCWeakRefLoadRetained(weak);
+    ASSERT_TRUE(loaded == string);
+    HCRelease(loaded);
+    HCRelease(string);
+    ASSERT_TRUE(HCWeakRefIsCleared(weak));
+    ASSERT_TRUE(HCWeakRefLoadRetained(weak) == NULL);
+    HCRelease(weak);
+}
+
+CTEST(HCWeakRef, EqualHash) {
+    HCStringRef string = HCStringCreateWithCString("weak");
+    HCWeakRefRef a = HCWeakRefCreate(string);
+    HCWeakRefRef b = HCWeakRefCreate(string);
+    ASSERT_TRUE(HCWeakRefIsEqual(a, a));
+    ASSERT_FALSE(HCWeakRefIsEqual(a, b));
+    ASSERT_EQUAL(HCWeakRefHashValue(a), HCWeakRefHashValue(a));
+    HCRelease(a);
+    HCRelease(b);
+    HCRelease(string);
+}
+
+CTEST(HCWeakRef, Print) {
+    HCWeakRefRef weak = HCWeakRefCreate(NULL);
+    HCWeakRefPrint(weak, stdout); // TODO: Not to stdout
+    HCPrint(weak, stdout); // TODO: Not to stdout
+    HCRelease(weak);
+}
+
+CTEST(HCWeakRef, Immediate) {
+    HCWeakRefRef null = HCWeakRefCreate(NULL);
+    ASSERT_TRUE(HCWeakRefIsCleared(null));
+    ASSERT_TRUE(HCWeakRefLoadRetained(null) == NULL);
+    HCRelease(null);
+    
+    HCNumberRef number = HCNumberCreateWithInteger(3);
+    HCWeakRefRef weak = HCWeakRefCreate(number);
+    HCRelease(number);
+    HCNumberRef loaded = HCWeakRefLoadRetained(weak);
+    ASSERT_EQUAL(HCNumberAsInteger(loaded), 3);
+    HCRelease(loaded);
+    HCRelease(weak);
+}
+
+CTEST(HCWeakRef, Many) {
+    // Weakly reference many objects, several times each, and release them in an order unrelated to creation
+    HCListRef list = HCListCreate();
+    HCListRef weaks = HCListCreate();
+    for (HCInteger index = 0; index < 1000; index++) {
+        HCNumberRef number = HCNumberCreateWithReal((HCReal)index + 0.5);
+        HCListAddObject(list, number);
+        for (HCInteger copy = 0; copy < 3; copy++) {
+            HCListAddObjectReleased(weaks, HCWeakRefCreate(number));
+        }
+        HCRelease(number);
+    }
+    for (HCInteger index = 0; index < 3000; index += 2) {
+        HCListRemoveObjectAtIndex(weaks, index / 2);
+    }
+    for (HCInteger index = 0; index < 1000; index += 2) {
+        HCListRemoveObjectAtIndex(list, index / 2);
+    }
+    for (HCListIterator i = HCListIterationBegin(weaks); !HCListIterationHasEnded(&i); HCListIterationNext(&i)) {
+        HCNumberRef loaded = HCWeakRefLoadRetained(i.object);
+        if (loaded != NULL) {
+            ASSERT_TRUE(HCListContainsObject(list, loaded));
+            HCRelease(loaded);
+        }
+    }
+    HCRelease(list);
+    for (HCListIterator i = HCListIterationBegin(weaks); !HCListIterationHasEnded(&i); HCListIterationNext(&i)) {
+        ASSERT_TRUE(HCWeakRefIsCleared(i.object));
+    }
+    HCRelease(weaks);
+}
+
+CTEST(HCWeakRef, DeferredRelease) {
+    HCStringRef string = HCStringCreateWithCString("deferred");
+    HCWeakRefRef weak = HCWeakRefCreate(string);
+    HCReleaseQueueSetDeferred(true);
+    HCRelease(string);
+    ASSERT_TRUE(HCWeakRefIsCleared(weak));
+    ASSERT_TRUE(HCWeakRefLoadRetained(weak) == NULL);
+    HCDrainReleaseQueue();
+    HCReleaseQueueSetDeferred(false);
+    HCRelease(weak);
+}
+
+static HCRef HCWeakRefTestCreateString(void* context) {
+    (void)context; // Unused
+    return HCStringCreateWithCString("arena");
+}
+
+CTEST(HCWeakRef, Arena) {
+    HCArenaRef arena = HCArenaCreate();
+    HCStringRef string = HCArenaCreateObject(arena, HCWeakRefTestCreateString, NULL);
+    HCWeakRefRef weak = HCWeakRefCreate(string);
+    ASSERT_FALSE(HCWeakRefIsCleared(weak));
+    HCRelease(arena);
+    ASSERT_TRUE(HCWeakRefIsCleared(weak));
+    HCRelease(weak);
+}
+
+static void HCWeakRefTestLoad(void* context) {
+    HCWeakRefRef weak = context;
+    for (HCInteger iteration = 0; iteration < 100000; iteration++) {
+        HCRef loaded = HCWeakRefLoadRetained(weak);
+        if (loaded == NULL) {
+            return;
+        }
+        HCRelease(loaded);
+    }
+}
+
+CTEST(HCWeakRef, Threads) {
+    // Load weak references on other threads while their objects are released
+    for (HCInteger iteration = 0; iteration < 100; iteration++) {
+        HCStringRef string = HCStringCreateWithCString("threads");
+        HCWeakRefRef weak = HCWeakRefCreate(string);
+        HCThreadRef thread = HCThreadCreate(HCWeakRefTestLoad, weak);
+        HCThreadExecute(thread);
+        HCRelease(string);
+        HCThreadJoin(thread);
+        ASSERT_TRUE(HCWeakRefIsCleared(weak));
+        HCRelease(thread);
+        HCRelease(weak);
+    }
+}
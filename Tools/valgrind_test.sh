@@ -4,9 +4,10 @@ source $(dirname $0)/cmake_common_source
 
 cd $(dirname $0)/..
 
-if [[ ! -d ${BUILD_DIR} ]]; then
-$(dirname $0)/build.sh
-fi
-
-cd ${BUILD_DIR}
+# NOTE: The slab allocator is disabled so valgrind can track each object allocation
+VALGRIND_BUILD_DIR="${BUILD_DIR}_valgrind"
+mkdir -p ${VALGRIND_BUILD_DIR}
+cd ${VALGRIND_BUILD_DIR}
+${CMAKE} -DNO_SLAB_ALLOCATOR=ON ..
+${MAKE}
 valgrind --leak-check=full --error-exitcode=1 ./hollowcoretest